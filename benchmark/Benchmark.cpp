@@ -0,0 +1,223 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <numeric>
+#include "Benchmark.h"
+#include "Log.h"
+#include "MdciiAssert.h"
+
+//-------------------------------------------------
+// Ctors. / Dtor.
+//-------------------------------------------------
+
+mdcii::benchmark::Benchmark::Benchmark(const int t_nrOfSamples, std::string t_filter)
+    : m_nrOfSamples{ t_nrOfSamples }
+    , m_filter{ std::move(t_filter) }
+{
+    MDCII_LOG_DEBUG("[Benchmark::Benchmark()] Create Benchmark.");
+
+    MDCII_ASSERT(m_nrOfSamples > 1, "[Benchmark::Benchmark()] Invalid number of samples.")
+}
+
+mdcii::benchmark::Benchmark::~Benchmark() noexcept
+{
+    MDCII_LOG_DEBUG("[Benchmark::~Benchmark()] Destruct Benchmark.");
+}
+
+//-------------------------------------------------
+// Logic
+//-------------------------------------------------
+
+void mdcii::benchmark::Benchmark::Run(const std::string& t_name, const std::function<void()>& t_func)
+{
+    if (!m_filter.empty() && t_name.find(m_filter) == std::string::npos)
+    {
+        return;
+    }
+
+    MDCII_LOG_INFO("[Benchmark::Run()] Run {} ...", t_name);
+
+    // warm up the caches and the allocator; the calls per sample grow until a sample is long enough
+    auto calls{ 1 };
+    const auto warmUpStart{ Clock::now() };
+    while (true)
+    {
+        const auto elapsed{ Time(t_func, calls) };
+        if (elapsed >= static_cast<double>(std::chrono::nanoseconds(MIN_SAMPLE_TIME).count()))
+        {
+            if (Clock::now() - warmUpStart >= MIN_WARM_UP_TIME)
+            {
+                break;
+            }
+            continue;
+        }
+
+        calls *= 2;
+    }
+
+    std::vector<double> samples(m_nrOfSamples);
+    for (auto& sample : samples)
+    {
+        sample = Time(t_func, calls) / calls;
+    }
+
+    m_results.push_back(CreateResult(t_name, std::move(samples), calls));
+}
+
+//-------------------------------------------------
+// Output
+//-------------------------------------------------
+
+void mdcii::benchmark::Benchmark::PrintResults() const
+{
+    fmt::print("{:<50} {:>8} {:>13} {:>13} {:>13} {:>12} {:>13} {:>9}\n",
+        "Benchmark", "Samples", "Median", "Mean", "95% CI", "CI [%]", "Min", "Outliers"
+    );
+
+    for (const auto& result : m_results)
+    {
+        fmt::print("{:<50} {:>8} {:>13} {:>13} {:>13} {:>12.2f} {:>13} {:>9}\n",
+            result.name,
+            fmt::format("{}x{}", result.nrOfSamples, result.callsPerSample),
+            FormatTime(result.median),
+            FormatTime(result.mean),
+            fmt::format("+-{}", FormatTime(result.ci95)),
+            result.mean > 0.0 ? 100.0 * result.ci95 / result.mean : 0.0,
+            FormatTime(result.min),
+            result.nrOfOutliers
+        );
+    }
+}
+
+bool mdcii::benchmark::Benchmark::WriteCsv(const std::string& t_filePath) const
+{
+    std::ofstream file{ t_filePath };
+    if (!file.is_open())
+    {
+        MDCII_LOG_WARN("[Benchmark::WriteCsv()] The file {} could not be opened.", t_filePath);
+
+        return false;
+    }
+
+    file << "name,samples,calls_per_sample,min_ns,median_ns,mean_ns,max_ns,stddev_ns,ci95_ns,mad_ns,outliers\n";
+    for (const auto& result : m_results)
+    {
+        file << fmt::format("\"{}\",{},{},{:.1f},{:.1f},{:.1f},{:.1f},{:.1f},{:.1f},{:.1f},{}\n",
+            result.name, result.nrOfSamples, result.callsPerSample,
+            result.min, result.median, result.mean, result.max,
+            result.stdDev, result.ci95, result.mad, result.nrOfOutliers
+        );
+    }
+
+    return true;
+}
+
+//-------------------------------------------------
+// Helper
+//-------------------------------------------------
+
+double mdcii::benchmark::Benchmark::Time(const std::function<void()>& t_func, const int t_calls)
+{
+    const auto start{ Clock::now() };
+    for (auto i{ 0 }; i < t_calls; ++i)
+    {
+        t_func();
+    }
+
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+}
+
+mdcii::benchmark::Result mdcii::benchmark::Benchmark::CreateResult(const std::string& t_name, std::vector<double> t_samples, const int t_callsPerSample)
+{
+    std::ranges::sort(t_samples);
+
+    Result result;
+    result.name = t_name;
+    result.nrOfSamples = static_cast<int>(t_samples.size());
+    result.callsPerSample = t_callsPerSample;
+    result.min = t_samples.front();
+    result.max = t_samples.back();
+    result.median = Median(t_samples);
+
+    const auto n{ static_cast<double>(t_samples.size()) };
+    result.mean = std::accumulate(t_samples.begin(), t_samples.end(), 0.0) / n;
+
+    auto squares{ 0.0 };
+    for (const auto sample : t_samples)
+    {
+        squares += (sample - result.mean) * (sample - result.mean);
+    }
+    result.stdDev = std::sqrt(squares / (n - 1.0));
+    result.ci95 = StudentT975(result.nrOfSamples - 1) * result.stdDev / std::sqrt(n);
+
+    // 1.4826 scales the MAD of normally distributed samples to their standard deviation
+    std::vector<double> deviations;
+    deviations.reserve(t_samples.size());
+    for (const auto sample : t_samples)
+    {
+        deviations.push_back(std::abs(sample - result.median));
+    }
+    std::ranges::sort(deviations);
+    result.mad = 1.4826 * Median(deviations);
+
+    result.nrOfOutliers = static_cast<int>(std::ranges::count_if(t_samples, [&result](const double t_sample) {
+        return std::abs(t_sample - result.median) > 3.0 * result.mad;
+    }));
+
+    return result;
+}
+
+double mdcii::benchmark::Benchmark::Median(const std::vector<double>& t_sorted)
+{
+    const auto n{ t_sorted.size() };
+
+    return n % 2 == 1 ? t_sorted[n / 2] : 0.5 * (t_sorted[n / 2 - 1] + t_sorted[n / 2]);
+}
+
+double mdcii::benchmark::Benchmark::StudentT975(const int t_degreesOfFreedom)
+{
+    // Cornish-Fisher expansion around the quantile of the normal distribution
+    constexpr auto z{ 1.959964 };
+    const auto df{ static_cast<double>(t_degreesOfFreedom) };
+    const auto z3{ z * z * z };
+    const auto z5{ z3 * z * z };
+    const auto z7{ z5 * z * z };
+
+    return z
+        + (z3 + z) / (4.0 * df)
+        + (5.0 * z5 + 16.0 * z3 + 3.0 * z) / (96.0 * df * df)
+        + (3.0 * z7 + 19.0 * z5 + 17.0 * z3 - 15.0 * z) / (384.0 * df * df * df);
+}
+
+std::string mdcii::benchmark::Benchmark::FormatTime(const double t_ns)
+{
+    if (t_ns >= 1.0e6)
+    {
+        return fmt::format("{:.3f} ms", t_ns / 1.0e6);
+    }
+
+    if (t_ns >= 1.0e3)
+    {
+        return fmt::format("{:.3f} us", t_ns / 1.0e3);
+    }
+
+    return fmt::format("{:.1f} ns", t_ns);
+}
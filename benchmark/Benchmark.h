@@ -0,0 +1,236 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace mdcii::benchmark
+{
+    //-------------------------------------------------
+    // Result
+    //-------------------------------------------------
+
+    /**
+     * @brief The statistics of a benchmark. All times are in nanoseconds per call.
+     */
+    struct Result
+    {
+        /**
+         * @brief The name of the benchmark.
+         */
+        std::string name;
+
+        /**
+         * @brief The number of samples.
+         */
+        int nrOfSamples{ 0 };
+
+        /**
+         * @brief The number of calls timed together in each sample.
+         */
+        int callsPerSample{ 0 };
+
+        double min{ 0.0 };
+        double median{ 0.0 };
+        double mean{ 0.0 };
+        double max{ 0.0 };
+
+        /**
+         * @brief The sample standard deviation.
+         */
+        double stdDev{ 0.0 };
+
+        /**
+         * @brief The half width of the 95% confidence interval of the mean.
+         */
+        double ci95{ 0.0 };
+
+        /**
+         * @brief The median absolute deviation, scaled to be comparable to the standard deviation.
+         */
+        double mad{ 0.0 };
+
+        /**
+         * @brief The number of samples further away from the median than three times the MAD.
+         */
+        int nrOfOutliers{ 0 };
+    };
+
+    //-------------------------------------------------
+    // Benchmark
+    //-------------------------------------------------
+
+    /**
+     * @brief Times functions and collects statistics of the timings.
+     *
+     * Each benchmark is warmed up first. Then the number of calls of a sample is chosen so that
+     * a sample lasts at least `MIN_SAMPLE_TIME`, which keeps the timer resolution out of the results.
+     */
+    class Benchmark
+    {
+    public:
+        //-------------------------------------------------
+        // Ctors. / Dtor.
+        //-------------------------------------------------
+
+        Benchmark() = delete;
+
+        /**
+         * @brief Constructs a new Benchmark object.
+         *
+         * @param t_nrOfSamples The number of samples of each benchmark.
+         * @param t_filter Only benchmarks containing this string in their name are run.
+         */
+        Benchmark(int t_nrOfSamples, std::string t_filter);
+
+        Benchmark(const Benchmark& t_other) = delete;
+        Benchmark(Benchmark&& t_other) noexcept = delete;
+        Benchmark& operator=(const Benchmark& t_other) = delete;
+        Benchmark& operator=(Benchmark&& t_other) noexcept = delete;
+
+        ~Benchmark() noexcept;
+
+        //-------------------------------------------------
+        // Logic
+        //-------------------------------------------------
+
+        /**
+         * @brief Times a function and stores the statistics.
+         *
+         * @param t_name The name of the benchmark.
+         * @param t_func The function to time.
+         */
+        void Run(const std::string& t_name, const std::function<void()>& t_func);
+
+        //-------------------------------------------------
+        // Output
+        //-------------------------------------------------
+
+        /**
+         * @brief Prints all results as a table.
+         */
+        void PrintResults() const;
+
+        /**
+         * @brief Writes all results to a CSV file.
+         *
+         * @param t_filePath The path of the file.
+         *
+         * @return True if the file was written; otherwise false.
+         */
+        [[nodiscard]] bool WriteCsv(const std::string& t_filePath) const;
+
+    protected:
+
+    private:
+        //-------------------------------------------------
+        // Types
+        //-------------------------------------------------
+
+        using Clock = std::chrono::steady_clock;
+
+        //-------------------------------------------------
+        // Constants
+        //-------------------------------------------------
+
+        /**
+         * @brief The minimum duration of a sample.
+         */
+        static constexpr std::chrono::milliseconds MIN_SAMPLE_TIME{ 10 };
+
+        /**
+         * @brief The minimum duration of the warm up.
+         */
+        static constexpr std::chrono::milliseconds MIN_WARM_UP_TIME{ 100 };
+
+        //-------------------------------------------------
+        // Member
+        //-------------------------------------------------
+
+        /**
+         * @brief The number of samples of each benchmark.
+         */
+        int m_nrOfSamples;
+
+        /**
+         * @brief Only benchmarks containing this string in their name are run.
+         */
+        std::string m_filter;
+
+        /**
+         * @brief The results of all benchmarks run so far.
+         */
+        std::vector<Result> m_results;
+
+        //-------------------------------------------------
+        // Helper
+        //-------------------------------------------------
+
+        /**
+         * @brief Calls a function several times and measures the time.
+         *
+         * @param t_func The function to call.
+         * @param t_calls The number of calls.
+         *
+         * @return The elapsed time in nanoseconds.
+         */
+        [[nodiscard]] static double Time(const std::function<void()>& t_func, int t_calls);
+
+        /**
+         * @brief Calculates the statistics of the samples.
+         *
+         * @param t_name The name of the benchmark.
+         * @param t_samples The time per call of each sample in nanoseconds.
+         * @param t_callsPerSample The number of calls of each sample.
+         *
+         * @return The statistics.
+         */
+        [[nodiscard]] static Result CreateResult(const std::string& t_name, std::vector<double> t_samples, int t_callsPerSample);
+
+        /**
+         * @brief Calculates the median of sorted values.
+         *
+         * @param t_sorted The sorted values.
+         *
+         * @return The median.
+         */
+        [[nodiscard]] static double Median(const std::vector<double>& t_sorted);
+
+        /**
+         * @brief Calculates the 97.5% quantile of the Student's t-distribution.
+         *
+         * @param t_degreesOfFreedom The degrees of freedom.
+         *
+         * @return The quantile.
+         */
+        [[nodiscard]] static double StudentT975(int t_degreesOfFreedom);
+
+        /**
+         * @brief Formats a time with a readable unit.
+         *
+         * @param t_ns The time in nanoseconds.
+         *
+         * @return The formatted time.
+         */
+        [[nodiscard]] static std::string FormatTime(double t_ns);
+    };
+}
@@ -0,0 +1,49 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#include "BenchmarkState.h"
+#include "Log.h"
+
+//-------------------------------------------------
+// Ctors. / Dtor.
+//-------------------------------------------------
+
+mdcii::benchmark::BenchmarkState::BenchmarkState(Game* t_game)
+    : State(t_game)
+{
+    MDCII_LOG_DEBUG("[BenchmarkState::BenchmarkState()] Create BenchmarkState.");
+}
+
+mdcii::benchmark::BenchmarkState::~BenchmarkState() noexcept
+{
+    MDCII_LOG_DEBUG("[BenchmarkState::~BenchmarkState()] Destruct BenchmarkState.");
+}
+
+//-------------------------------------------------
+// Override
+//-------------------------------------------------
+
+bool mdcii::benchmark::BenchmarkState::OnUserCreate([[maybe_unused]] void* t_data)
+{
+    return true;
+}
+
+bool mdcii::benchmark::BenchmarkState::OnUserUpdate([[maybe_unused]] const float t_elapsedTime)
+{
+    return true;
+}
@@ -0,0 +1,67 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#pragma once
+
+#include "state/State.h"
+
+namespace mdcii::benchmark
+{
+    //-------------------------------------------------
+    // BenchmarkState
+    //-------------------------------------------------
+
+    /**
+     * @brief The parent State of the benchmarked worlds. Nothing is done on updates.
+     */
+    class BenchmarkState : public state::State
+    {
+    public:
+        //-------------------------------------------------
+        // Ctors. / Dtor.
+        //-------------------------------------------------
+
+        BenchmarkState() = delete;
+
+        /**
+         * @brief Constructs a new BenchmarkState object.
+         *
+         * @param t_game Pointer to the parent Game object.
+         */
+        explicit BenchmarkState(Game* t_game);
+
+        BenchmarkState(const BenchmarkState& t_other) = delete;
+        BenchmarkState(BenchmarkState&& t_other) noexcept = delete;
+        BenchmarkState& operator=(const BenchmarkState& t_other) = delete;
+        BenchmarkState& operator=(BenchmarkState&& t_other) noexcept = delete;
+
+        ~BenchmarkState() noexcept override;
+
+        //-------------------------------------------------
+        // Override
+        //-------------------------------------------------
+
+        [[nodiscard]] bool OnUserCreate(void* t_data) override;
+        [[nodiscard]] bool OnUserUpdate(float t_elapsedTime) override;
+
+    protected:
+
+    private:
+
+    };
+}
@@ -0,0 +1,129 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#define OLC_PGE_APPLICATION
+#define OLC_PGEX_DEAR_IMGUI_IMPLEMENTATION
+
+#include <filesystem>
+#include "Log.h"
+#include "Game.h"
+#include "MdciiException.h"
+#include "Benchmark.h"
+#include "BenchmarkState.h"
+#include "WorldBenchmarks.h"
+#include "job/JobSystem.h"
+#include "job/TaskQueue.h"
+#include "resource/OriginalResourcesManager.h"
+#include "resource/MdciiResourcesManager.h"
+
+//-------------------------------------------------
+// Main
+//-------------------------------------------------
+
+int main(int t_argc, char* t_argv[])
+{
+    mdcii::Log::Init();
+
+    // the debug messages of the hot paths would be measured too
+    mdcii::Log::GetLogger()->set_level(spdlog::level::info);
+
+    auto nrOfSamples{ 30 };
+    std::string filter;
+    std::string csvFilePath;
+
+    for (auto i{ 1 }; i < t_argc; ++i)
+    {
+        const std::string arg{ t_argv[i] };
+        const auto hasValue{ i + 1 < t_argc };
+
+        if (arg == "--samples" && hasValue)
+        {
+            nrOfSamples = std::max(2, std::stoi(t_argv[++i]));
+        }
+        else if (arg == "--filter" && hasValue)
+        {
+            filter = t_argv[++i];
+        }
+        else if (arg == "--csv" && hasValue)
+        {
+            csvFilePath = t_argv[++i];
+        }
+        else
+        {
+            fmt::print("Usage: {} [--samples N] [--filter TEXT] [--csv FILE]\n", t_argv[0]);
+            return arg == "--help" ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+#if defined(MDCII_DEBUG_BUILD)
+    MDCII_LOG_WARN("[main()] This is a debug build. The results are not meaningful.");
+#endif
+
+    try
+    {
+        // the buildings and figures are read from the Json files of the fixtures
+        if (!std::filesystem::exists(mdcii::Game::RESOURCES_REL_PATH + "haeuser.json") ||
+            !std::filesystem::exists(mdcii::Game::RESOURCES_REL_PATH + "figuren.json"))
+        {
+            throw MDCII_EXCEPTION("[main()] The benchmark fixtures are missing in " + mdcii::Game::RESOURCES_REL_PATH + ".");
+        }
+
+        mdcii::Game game;
+        game.jobSystem = std::make_unique<mdcii::job::JobSystem>();
+        game.taskQueue = std::make_unique<mdcii::job::TaskQueue>();
+        game.originalResourcesManager = std::make_unique<mdcii::resource::OriginalResourcesManager>("haeuser.cod", "figuren.cod");
+        game.mdciiResourcesManager = std::make_unique<mdcii::resource::MdciiResourcesManager>();
+        game.CreateLayer();
+
+        mdcii::benchmark::BenchmarkState state{ &game };
+        mdcii::benchmark::Benchmark benchmark{ nrOfSamples, filter };
+        mdcii::benchmark::WorldBenchmarks worldBenchmarks{ &state, &benchmark };
+
+        for (const auto* files : { &game.mdciiResourcesManager->mapFiles, &game.mdciiResourcesManager->saveGameFiles, &game.mdciiResourcesManager->islandFiles })
+        {
+            for (const auto& file : *files)
+            {
+                worldBenchmarks.Run(file);
+            }
+        }
+
+        benchmark.PrintResults();
+        MDCII_LOG_DEBUG("[main()] Sink {}.", worldBenchmarks.GetSink());
+
+        if (!csvFilePath.empty() && !benchmark.WriteCsv(csvFilePath))
+        {
+            throw MDCII_EXCEPTION("[main()] Error while writing file " + csvFilePath + ".");
+        }
+
+        return EXIT_SUCCESS;
+    }
+    catch (const mdcii::MdciiException& e)
+    {
+        MDCII_LOG_ERROR("MdciiException {}", e.what());
+    }
+    catch (const std::exception& e)
+    {
+        MDCII_LOG_ERROR("Standard Exception: {}", e.what());
+    }
+    catch (...)
+    {
+        MDCII_LOG_ERROR("Unknown Exception. No details available.");
+    }
+
+    return EXIT_FAILURE;
+}
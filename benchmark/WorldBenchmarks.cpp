@@ -0,0 +1,257 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#include <filesystem>
+#include "WorldBenchmarks.h"
+#include "Benchmark.h"
+#include "Game.h"
+#include "MdciiAssert.h"
+#include "MdciiException.h"
+#include "state/State.h"
+#include "resource/MdciiFile.h"
+#include "resource/AnimationClock.h"
+#include "world/World.h"
+#include "world/Island.h"
+#include "world/DeepWater.h"
+#include "world/layer/MixedLayer.h"
+#include "camera/Camera.h"
+#include "renderer/Renderer.h"
+#include "renderer/DrawList.h"
+
+//-------------------------------------------------
+// Ctors. / Dtor.
+//-------------------------------------------------
+
+mdcii::benchmark::WorldBenchmarks::WorldBenchmarks(state::State* t_state, Benchmark* t_benchmark)
+    : m_state{ t_state }
+    , m_benchmark{ t_benchmark }
+{
+    MDCII_LOG_DEBUG("[WorldBenchmarks::WorldBenchmarks()] Create WorldBenchmarks.");
+
+    MDCII_ASSERT(m_state, "[WorldBenchmarks::WorldBenchmarks()] Null pointer.")
+    MDCII_ASSERT(m_benchmark, "[WorldBenchmarks::WorldBenchmarks()] Null pointer.")
+}
+
+mdcii::benchmark::WorldBenchmarks::~WorldBenchmarks() noexcept
+{
+    MDCII_LOG_DEBUG("[WorldBenchmarks::~WorldBenchmarks()] Destruct WorldBenchmarks.");
+}
+
+//-------------------------------------------------
+// Logic
+//-------------------------------------------------
+
+void mdcii::benchmark::WorldBenchmarks::Run(const resource::MdciiFile& t_file)
+{
+    const auto name{ std::filesystem::path(t_file.GetFileName()).filename().string() };
+
+    MDCII_LOG_INFO("[WorldBenchmarks::Run()] Run the benchmarks with file {}.", name);
+
+    RunLoad(name, t_file.GetFileName());
+
+    // all other cases share this world
+    const auto world{ CreateWorld(t_file.GetFileName()) };
+
+    // without a renderer there are no imposter images
+    world->renderLayer = world::RENDER_ALL;
+
+    RunCulling(name, world.get());
+    RunRenderOrder(name, world.get());
+    RunAddTiles(name, world.get());
+    RunDrawList(name, world.get());
+}
+
+//-------------------------------------------------
+// Cases
+//-------------------------------------------------
+
+void mdcii::benchmark::WorldBenchmarks::RunLoad(const std::string& t_name, const std::string& t_fileName)
+{
+    m_benchmark->Run(t_name + "/load", [&]() {
+        const auto world{ CreateWorld(t_fileName) };
+        m_sink += world->islands.size();
+    });
+}
+
+void mdcii::benchmark::WorldBenchmarks::RunCulling(const std::string& t_name, world::World* t_world)
+{
+    for (const auto zoom : magic_enum::enum_values<world::Zoom>())
+    {
+        t_world->camera->zoom = zoom;
+
+        m_benchmark->Run(fmt::format("{}/culling sweep {}", t_name, magic_enum::enum_name(zoom)), [&]() {
+            for (const auto rotation : magic_enum::enum_values<world::Rotation>())
+            {
+                t_world->camera->rotation = rotation;
+
+                for (auto y{ 1 }; y <= SWEEP_STEPS; ++y)
+                {
+                    for (auto x{ 1 }; x <= SWEEP_STEPS; ++x)
+                    {
+                        CenterCamera(t_world, x * t_world->worldWidth / (SWEEP_STEPS + 1), y * t_world->worldHeight / (SWEEP_STEPS + 1));
+                        t_world->UpdateVisibleArea();
+                        m_sink += t_world->currentIslands.size();
+                    }
+                }
+            }
+        });
+    }
+
+    t_world->camera->rotation = world::Rotation::DEG0;
+}
+
+void mdcii::benchmark::WorldBenchmarks::RunRenderOrder(const std::string& t_name, world::World* t_world)
+{
+    for (const auto zoom : magic_enum::enum_values<world::Zoom>())
+    {
+        t_world->camera->zoom = zoom;
+        CenterCamera(t_world, t_world->worldWidth / 2, t_world->worldHeight / 2);
+        t_world->UpdateVisibleArea();
+
+        m_benchmark->Run(fmt::format("{}/render order {}", t_name, magic_enum::enum_name(zoom)), [&]() {
+            for (auto* island : t_world->currentIslands)
+            {
+                island->GetMixedLayer()->ForEachCurrentTile([&](const world::tile::TerrainTile& t_tile) {
+                    m_sink += static_cast<std::size_t>(t_tile.posX + t_tile.posY);
+                });
+            }
+        });
+    }
+}
+
+void mdcii::benchmark::WorldBenchmarks::RunAddTiles(const std::string& t_name, world::World* t_world)
+{
+    using enum world::layer::LayerType;
+
+    // adding the tiles that are already there changes nothing, so each call does the same work
+    std::vector<std::vector<world::tile::TerrainTile>> islandTiles;
+    for (const auto& island : t_world->islands)
+    {
+        auto& tiles{ islandTiles.emplace_back() };
+        std::ranges::copy_if(island->GetTerrainLayer(TERRAIN)->tiles, std::back_inserter(tiles), [](const world::tile::TerrainTile& t_tile) {
+            return t_tile.HasBuilding();
+        });
+    }
+
+    m_benchmark->Run(t_name + "/add tiles", [&]() {
+        for (auto i{ 0u }; i < t_world->islands.size(); ++i)
+        {
+            auto& tiles{ islandTiles[i] };
+            if (tiles.empty())
+            {
+                continue;
+            }
+
+            auto* island{ t_world->islands[i].get() };
+            island->GetTerrainLayer(TERRAIN)->AddTiles(tiles);
+            for (const auto& tile : tiles)
+            {
+                island->GetMixedLayer()->UpdateSource(tile.posX, tile.posY);
+            }
+            island->ClearChanges();
+
+            m_sink += tiles.size();
+        }
+    });
+}
+
+void mdcii::benchmark::WorldBenchmarks::RunDrawList(const std::string& t_name, world::World* t_world)
+{
+    for (const auto zoom : magic_enum::enum_values<world::Zoom>())
+    {
+        t_world->camera->zoom = zoom;
+        CenterCamera(t_world, t_world->worldWidth / 2, t_world->worldHeight / 2);
+        t_world->UpdateVisibleArea();
+
+        m_benchmark->Run(fmt::format("{}/draw list build {}", t_name, magic_enum::enum_name(zoom)), [&]() {
+            renderer::Renderer::Render(t_world, true);
+            Submit(t_world);
+        });
+
+        // the frames between two rebuilds only patch the animated draws
+        m_benchmark->Run(fmt::format("{}/draw list frame {}", t_name, magic_enum::enum_name(zoom)), [&]() {
+            resource::AnimationClock::Update(FRAME_TIME);
+            t_world->deepWater->UpdateAnimation();
+            for (auto* island : t_world->currentIslands)
+            {
+                island->UpdateAnimations();
+            }
+            renderer::Renderer::Render(t_world, false);
+            Submit(t_world);
+        });
+    }
+}
+
+//-------------------------------------------------
+// Helper
+//-------------------------------------------------
+
+std::unique_ptr<mdcii::world::World> mdcii::benchmark::WorldBenchmarks::CreateWorld(const std::string& t_fileName) const
+{
+    resource::MdciiFile file{ t_fileName };
+    if (!file.SetJsonFromFile())
+    {
+        throw MDCII_EXCEPTION("[WorldBenchmarks::CreateWorld()] Error while reading file " + t_fileName + ".");
+    }
+
+    const auto& json{ file.GetJson() };
+
+    return std::make_unique<world::World>(m_state, json.contains("world") ? json : CreateWorldJson(json));
+}
+
+nlohmann::json mdcii::benchmark::WorldBenchmarks::CreateWorldJson(const nlohmann::json& t_islandJson)
+{
+    // brace initialization would create an array
+    auto islandJson = t_islandJson;
+    islandJson["x"] = ISLAND_MARGIN;
+    islandJson["y"] = ISLAND_MARGIN;
+
+    nlohmann::json json;
+    json["world"] = {
+        { "width", t_islandJson.at("width").get<int>() + 2 * ISLAND_MARGIN },
+        { "height", t_islandJson.at("height").get<int>() + 2 * ISLAND_MARGIN }
+    };
+    json["islands"] = nlohmann::json::array({ islandJson });
+
+    return json;
+}
+
+void mdcii::benchmark::WorldBenchmarks::CenterCamera(const world::World* t_world, const int t_x, const int t_y)
+{
+    const auto& camera{ t_world->camera };
+    const auto position{ rotate_position(t_x, t_y, t_world->worldWidth, t_world->worldHeight, camera->rotation) };
+    const auto tileWidth{ get_tile_width(camera->zoom) };
+    const auto tileHeight{ get_tile_height(camera->zoom) };
+
+    const olc::vi2d screen{
+        Game::INI.Get<int>("window", "width") / 2 - (position.x - position.y) * tileWidth / 2,
+        Game::INI.Get<int>("window", "height") / 2 - (position.x + position.y) * tileHeight / 2
+    };
+
+    camera->worldPosition = { screen.x / tileWidth, screen.y / tileHeight };
+    camera->origin = camera->worldPosition;
+    camera->screenPosition = { camera->worldPosition.x * tileWidth, camera->worldPosition.y * tileHeight };
+}
+
+void mdcii::benchmark::WorldBenchmarks::Submit(const world::World* t_world) const
+{
+    t_world->drawList->Submit();
+
+    // nothing is drawn without a renderer, so the engine would only collect the decal instances
+    m_state->game->GetLayers()[0].vecDecalInstance.clear();
+}
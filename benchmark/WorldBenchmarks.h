@@ -0,0 +1,197 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#pragma once
+
+#include <memory>
+#include "vendor/nlohmann/json.hpp"
+
+//-------------------------------------------------
+// Forward declarations
+//-------------------------------------------------
+
+namespace mdcii::state
+{
+    /**
+     * @brief Forward declaration class State.
+     */
+    class State;
+}
+
+namespace mdcii::resource
+{
+    /**
+     * @brief Forward declaration class MdciiFile.
+     */
+    class MdciiFile;
+}
+
+namespace mdcii::world
+{
+    /**
+     * @brief Forward declaration class World.
+     */
+    class World;
+}
+
+namespace mdcii::benchmark
+{
+    /**
+     * @brief Forward declaration class Benchmark.
+     */
+    class Benchmark;
+
+    //-------------------------------------------------
+    // WorldBenchmarks
+    //-------------------------------------------------
+
+    /**
+     * @brief The benchmark cases of the world hot paths.
+     */
+    class WorldBenchmarks
+    {
+    public:
+        //-------------------------------------------------
+        // Ctors. / Dtor.
+        //-------------------------------------------------
+
+        WorldBenchmarks() = delete;
+
+        /**
+         * @brief Constructs a new WorldBenchmarks object.
+         *
+         * @param t_state Pointer to the parent State of the worlds.
+         * @param t_benchmark Pointer to the Benchmark object that runs the cases.
+         */
+        WorldBenchmarks(state::State* t_state, Benchmark* t_benchmark);
+
+        WorldBenchmarks(const WorldBenchmarks& t_other) = delete;
+        WorldBenchmarks(WorldBenchmarks&& t_other) noexcept = delete;
+        WorldBenchmarks& operator=(const WorldBenchmarks& t_other) = delete;
+        WorldBenchmarks& operator=(WorldBenchmarks&& t_other) noexcept = delete;
+
+        ~WorldBenchmarks() noexcept;
+
+        //-------------------------------------------------
+        // Logic
+        //-------------------------------------------------
+
+        /**
+         * @brief Runs all cases with a map, savegame or island file.
+         *
+         * @param t_file The file to load.
+         */
+        void Run(const resource::MdciiFile& t_file);
+
+        /**
+         * @brief Getter for a value derived from the results of all cases.
+         *
+         * Printing it keeps the compiler from removing work whose result is not used otherwise.
+         */
+        [[nodiscard]] std::size_t GetSink() const { return m_sink; }
+
+    protected:
+
+    private:
+        //-------------------------------------------------
+        // Constants
+        //-------------------------------------------------
+
+        /**
+         * @brief The number of deep water tiles around an island loaded from an island file.
+         */
+        static constexpr auto ISLAND_MARGIN{ 8 };
+
+        /**
+         * @brief The number of view centers per axis of the culling sweep.
+         */
+        static constexpr auto SWEEP_STEPS{ 4 };
+
+        /**
+         * @brief The elapsed time per frame in seconds used for the animations.
+         */
+        static constexpr auto FRAME_TIME{ 0.13f };
+
+        //-------------------------------------------------
+        // Member
+        //-------------------------------------------------
+
+        /**
+         * @brief Pointer to the parent State of the worlds.
+         */
+        state::State* m_state{ nullptr };
+
+        /**
+         * @brief Pointer to the Benchmark object that runs the cases.
+         */
+        Benchmark* m_benchmark{ nullptr };
+
+        /**
+         * @brief Accumulates the results of the cases.
+         */
+        std::size_t m_sink{ 0 };
+
+        //-------------------------------------------------
+        // Cases
+        //-------------------------------------------------
+
+        void RunLoad(const std::string& t_name, const std::string& t_fileName);
+        void RunCulling(const std::string& t_name, world::World* t_world);
+        void RunRenderOrder(const std::string& t_name, world::World* t_world);
+        void RunAddTiles(const std::string& t_name, world::World* t_world);
+        void RunDrawList(const std::string& t_name, world::World* t_world);
+
+        //-------------------------------------------------
+        // Helper
+        //-------------------------------------------------
+
+        /**
+         * @brief Creates a world from a map, savegame or island file.
+         *
+         * @param t_fileName The full path of the file.
+         *
+         * @return The created World object.
+         */
+        [[nodiscard]] std::unique_ptr<world::World> CreateWorld(const std::string& t_fileName) const;
+
+        /**
+         * @brief Places an island in the middle of a world with deep water around it.
+         *
+         * @param t_islandJson The Json value of an island file.
+         *
+         * @return The Json value of a world.
+         */
+        [[nodiscard]] static nlohmann::json CreateWorldJson(const nlohmann::json& t_islandJson);
+
+        /**
+         * @brief Moves the camera so that a world position is in the middle of the screen.
+         *
+         * @param t_world Pointer to the World object.
+         * @param t_x The world x position.
+         * @param t_y The world y position.
+         */
+        static void CenterCamera(const world::World* t_world, int t_x, int t_y);
+
+        /**
+         * @brief Submits the recorded draws and throws away the decal instances.
+         *
+         * @param t_world Pointer to the World object.
+         */
+        void Submit(const world::World* t_world) const;
+    };
+}
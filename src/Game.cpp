@@ -18,11 +18,14 @@
 
 #include "Game.h"
 #include "Log.h"
+#include "Profiler.h"
 #include "GameState.h"
 #include "MainMenuState.h"
 #include "IslandGeneratorState.h"
 #include "WorldGeneratorState.h"
 #include "Intl.h"
+#include "job/JobSystem.h"
+#include "job/TaskQueue.h"
 #include "resource/OriginalResourcesManager.h"
 #include "resource/MdciiResourcesManager.h"
 #include "resource/AssetManager.h"
@@ -53,7 +56,9 @@ bool mdcii::Game::OnUserCreate()
     engine.InitialiseAudio(44100, 2);
     */
 
-    originalResourcesManager = std::make_unique<resource::OriginalResourcesManager>();
+    jobSystem = std::make_unique<job::JobSystem>();
+    taskQueue = std::make_unique<job::TaskQueue>();
+    originalResourcesManager = std::make_unique<resource::OriginalResourcesManager>(jobSystem.get());
     mdciiResourcesManager = std::make_unique<resource::MdciiResourcesManager>();
     assetManager = std::make_unique<resource::AssetManager>();
 
@@ -73,6 +78,11 @@ bool mdcii::Game::OnUserCreate()
 
 bool mdcii::Game::OnUserUpdate(float t_elapsedTime)
 {
+    MDCII_PROFILE_NEW_FRAME();
+
+    // the images of the last frame have been drawn
+    originalResourcesManager->ReleaseUnusedBshTextures();
+
     /*
     if (GetKey(olc::Key::K1).bPressed)
     {
@@ -44,6 +44,19 @@ namespace mdcii::resource
     class AssetManager;
 }
 
+namespace mdcii::job
+{
+    /**
+     * @brief Forward declaration class JobSystem.
+     */
+    class JobSystem;
+
+    /**
+     * @brief Forward declaration class TaskQueue.
+     */
+    class TaskQueue;
+}
+
 namespace mdcii::state
 {
     /**
@@ -108,6 +121,8 @@ namespace mdcii
         // Member
         //-------------------------------------------------
 
+        std::unique_ptr<job::JobSystem> jobSystem;
+        std::unique_ptr<job::TaskQueue> taskQueue;
         std::unique_ptr<resource::OriginalResourcesManager> originalResourcesManager;
         std::unique_ptr<resource::MdciiResourcesManager> mdciiResourcesManager;
         std::unique_ptr<resource::AssetManager> assetManager;
@@ -0,0 +1,238 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#include "Profiler.h"
+
+#ifdef MDCII_ENABLE_PROFILER
+
+#include <algorithm>
+#include <fstream>
+#include "Log.h"
+#include "vendor/imgui/imgui.h"
+#include "vendor/nlohmann/json.hpp"
+
+//-------------------------------------------------
+// Logic
+//-------------------------------------------------
+
+void mdcii::Profiler::AddSample(const std::string_view t_name, const Clock::time_point t_start, const Clock::time_point t_end)
+{
+    std::lock_guard lock{ m_mutex };
+
+    auto& scope{ m_scopes[t_name] };
+    scope.frameMs += std::chrono::duration<double, std::milli>(t_end - t_start).count();
+    scope.frameCalls++;
+
+    if (m_recording)
+    {
+        const auto startUs{ ToMicroseconds(t_start) };
+        AddTraceEvent({ t_name, startUs, ToMicroseconds(t_end) - startUs, 0, GetThreadIndex(), false });
+    }
+}
+
+void mdcii::Profiler::AddCounter(const std::string_view t_name, const int64_t t_value)
+{
+    std::lock_guard lock{ m_mutex };
+
+    auto& counter{ m_counters[t_name] };
+    counter.frameValue += t_value;
+    counter.touched = true;
+}
+
+void mdcii::Profiler::NewFrame()
+{
+    std::lock_guard lock{ m_mutex };
+
+    // scopes and counters that were not used in the frame keep their last values
+    for (auto& [name, scope] : m_scopes)
+    {
+        if (scope.frameCalls == 0)
+        {
+            continue;
+        }
+
+        scope.avgMs = scope.lastCalls == 0 ? scope.frameMs : scope.avgMs + AVG_WEIGHT * (scope.frameMs - scope.avgMs);
+        scope.maxMs = std::max(scope.maxMs, scope.frameMs);
+        scope.lastMs = scope.frameMs;
+        scope.lastCalls = scope.frameCalls;
+        scope.frameMs = 0.0;
+        scope.frameCalls = 0;
+    }
+
+    const auto nowUs{ ToMicroseconds(Clock::now()) };
+    for (auto& [name, counter] : m_counters)
+    {
+        if (!counter.touched)
+        {
+            continue;
+        }
+
+        counter.lastValue = counter.frameValue;
+        counter.frameValue = 0;
+        counter.touched = false;
+
+        if (m_recording)
+        {
+            AddTraceEvent({ name, nowUs, 0, counter.lastValue, 0, true });
+        }
+    }
+}
+
+bool mdcii::Profiler::SaveTrace(const std::string& t_filePath)
+{
+    std::lock_guard lock{ m_mutex };
+
+    // the oldest events first
+    std::ranges::rotate(m_traceEvents, m_traceEvents.begin() + m_nextTraceEvent);
+    m_nextTraceEvent = 0;
+
+    auto traceEvents{ nlohmann::json::array() };
+    for (const auto& [name, startUs, durationUs, value, threadIndex, isCounter] : m_traceEvents)
+    {
+        if (isCounter)
+        {
+            traceEvents.push_back({ { "name", std::string(name) }, { "ph", "C" }, { "ts", startUs }, { "pid", 0 }, { "args", { { "value", value } } } });
+        }
+        else
+        {
+            traceEvents.push_back({ { "name", std::string(name) }, { "cat", "mdcii" }, { "ph", "X" }, { "ts", startUs }, { "dur", durationUs }, { "pid", 0 }, { "tid", threadIndex } });
+        }
+    }
+
+    std::ofstream file{ t_filePath };
+    if (!file)
+    {
+        MDCII_LOG_WARN("[Profiler::SaveTrace()] Error while opening file {}.", t_filePath);
+        return false;
+    }
+
+    file << nlohmann::json{ { "traceEvents", traceEvents }, { "displayTimeUnit", "ms" } };
+
+    MDCII_LOG_INFO("[Profiler::SaveTrace()] Saved {} trace events to {}.", m_traceEvents.size(), t_filePath);
+
+    m_traceEvents.clear();
+
+    return true;
+}
+
+//-------------------------------------------------
+// ImGui
+//-------------------------------------------------
+
+void mdcii::Profiler::RenderImGui()
+{
+    ImGui::Begin("Profiler");
+
+    {
+        std::lock_guard lock{ m_mutex };
+
+        ImGui::Checkbox("Record trace", &m_recording);
+        ImGui::SameLine();
+        ImGui::Text("%d events", static_cast<int>(m_traceEvents.size()));
+
+        std::vector<std::pair<std::string_view, ScopeStats>> scopes{ m_scopes.begin(), m_scopes.end() };
+        std::ranges::sort(scopes, [](const auto& t_a, const auto& t_b) { return t_a.first < t_b.first; });
+
+        if (ImGui::BeginTable("Scopes", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+        {
+            ImGui::TableSetupColumn("Scope");
+            ImGui::TableSetupColumn("Last ms");
+            ImGui::TableSetupColumn("Avg ms");
+            ImGui::TableSetupColumn("Max ms");
+            ImGui::TableSetupColumn("Calls");
+            ImGui::TableHeadersRow();
+
+            for (const auto& [name, scope] : scopes)
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(name.data(), name.data() + name.size());
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", scope.lastMs);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", scope.avgMs);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", scope.maxMs);
+                ImGui::TableNextColumn();
+                ImGui::Text("%d", scope.lastCalls);
+            }
+
+            ImGui::EndTable();
+        }
+
+        std::vector<std::pair<std::string_view, CounterStats>> counters{ m_counters.begin(), m_counters.end() };
+        std::ranges::sort(counters, [](const auto& t_a, const auto& t_b) { return t_a.first < t_b.first; });
+
+        if (ImGui::BeginTable("Counters", 2, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+        {
+            ImGui::TableSetupColumn("Counter");
+            ImGui::TableSetupColumn("Last");
+            ImGui::TableHeadersRow();
+
+            for (const auto& [name, counter] : counters)
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(name.data(), name.data() + name.size());
+                ImGui::TableNextColumn();
+                ImGui::Text("%lld", static_cast<long long>(counter.lastValue));
+            }
+
+            ImGui::EndTable();
+        }
+    }
+
+    if (ImGui::Button("Save Chrome Trace"))
+    {
+        SaveTrace("mdcii_trace.json");
+    }
+
+    ImGui::End();
+}
+
+//-------------------------------------------------
+// Helper
+//-------------------------------------------------
+
+int mdcii::Profiler::GetThreadIndex()
+{
+    const auto [it, inserted]{ m_threadIndices.try_emplace(std::this_thread::get_id(), static_cast<int>(m_threadIndices.size())) };
+
+    return it->second;
+}
+
+int64_t mdcii::Profiler::ToMicroseconds(const Clock::time_point t_time)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(t_time - m_startTime).count();
+}
+
+void mdcii::Profiler::AddTraceEvent(const TraceEvent& t_event)
+{
+    // keep the most recent events
+    if (static_cast<int>(m_traceEvents.size()) >= MAX_TRACE_EVENTS)
+    {
+        m_traceEvents[m_nextTraceEvent] = t_event;
+        m_nextTraceEvent = (m_nextTraceEvent + 1) % MAX_TRACE_EVENTS;
+
+        return;
+    }
+
+    m_traceEvents.push_back(t_event);
+}
+
+#endif
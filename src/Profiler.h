@@ -0,0 +1,282 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#pragma once
+
+#ifdef MDCII_DEBUG_BUILD
+    #define MDCII_ENABLE_PROFILER
+#endif
+
+#ifdef MDCII_ENABLE_PROFILER
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace mdcii
+{
+    //-------------------------------------------------
+    // Profiler
+    //-------------------------------------------------
+
+    /**
+     * @brief Collects the timings of scopes and the values of counters.
+     *
+     * The results of the last frame are shown in an ImGui window. The scopes can also be
+     * recorded and saved as Chrome trace events, which can be opened with `chrome://tracing`.
+     * The Profiler only exists in debug builds; in release builds the macros are empty.
+     */
+    class Profiler
+    {
+    public:
+        //-------------------------------------------------
+        // Types
+        //-------------------------------------------------
+
+        using Clock = std::chrono::steady_clock;
+
+        //-------------------------------------------------
+        // Logic
+        //-------------------------------------------------
+
+        /**
+         * @brief Adds the duration of a scope.
+         *
+         * @param t_name The name of the scope; must be a string literal.
+         * @param t_start The start time.
+         * @param t_end The end time.
+         */
+        static void AddSample(std::string_view t_name, Clock::time_point t_start, Clock::time_point t_end);
+
+        /**
+         * @brief Adds a value to a counter of the current frame.
+         *
+         * @param t_name The name of the counter; must be a string literal.
+         * @param t_value The value to add.
+         */
+        static void AddCounter(std::string_view t_name, int64_t t_value);
+
+        /**
+         * @brief Completes the current frame and makes its results visible.
+         */
+        static void NewFrame();
+
+        /**
+         * @brief Writes the recorded scopes and counters as Chrome trace events.
+         *
+         * @param t_filePath The path of the Json file.
+         *
+         * @return True if the file was written; otherwise false.
+         */
+        static bool SaveTrace(const std::string& t_filePath);
+
+        //-------------------------------------------------
+        // ImGui
+        //-------------------------------------------------
+
+        /**
+         * @brief Renders the results in an ImGui window.
+         */
+        static void RenderImGui();
+
+    protected:
+
+    private:
+        //-------------------------------------------------
+        // Types
+        //-------------------------------------------------
+
+        /**
+         * @brief The timings of a scope in milliseconds.
+         */
+        struct ScopeStats
+        {
+            double frameMs{ 0.0 };
+            int frameCalls{ 0 };
+            double lastMs{ 0.0 };
+            int lastCalls{ 0 };
+            double avgMs{ 0.0 };
+            double maxMs{ 0.0 };
+        };
+
+        /**
+         * @brief The value of a counter.
+         */
+        struct CounterStats
+        {
+            int64_t frameValue{ 0 };
+            bool touched{ false };
+            int64_t lastValue{ 0 };
+        };
+
+        /**
+         * @brief A recorded scope or counter.
+         */
+        struct TraceEvent
+        {
+            std::string_view name;
+            int64_t startUs{ 0 };
+            int64_t durationUs{ 0 };
+            int64_t value{ 0 };
+            int threadIndex{ 0 };
+            bool isCounter{ false };
+        };
+
+        //-------------------------------------------------
+        // Constants
+        //-------------------------------------------------
+
+        /**
+         * @brief The maximum number of recorded trace events; the oldest events are overwritten.
+         */
+        static constexpr auto MAX_TRACE_EVENTS{ 1 << 18 };
+
+        /**
+         * @brief The weight of the last frame in the average.
+         */
+        static constexpr auto AVG_WEIGHT{ 0.05 };
+
+        //-------------------------------------------------
+        // Member
+        //-------------------------------------------------
+
+        /**
+         * @brief Protects all members, as scopes can be measured on worker threads.
+         */
+        inline static std::mutex m_mutex;
+
+        /**
+         * @brief The reference time of the trace events.
+         */
+        inline static const Clock::time_point m_startTime{ Clock::now() };
+
+        /**
+         * @brief The timings of each scope.
+         */
+        inline static std::unordered_map<std::string_view, ScopeStats> m_scopes;
+
+        /**
+         * @brief The values of each counter.
+         */
+        inline static std::unordered_map<std::string_view, CounterStats> m_counters;
+
+        /**
+         * @brief The small index of each thread used in the trace events.
+         */
+        inline static std::unordered_map<std::thread::id, int> m_threadIndices;
+
+        /**
+         * @brief The recorded trace events, used as a ring buffer once `MAX_TRACE_EVENTS` is reached.
+         */
+        inline static std::vector<TraceEvent> m_traceEvents;
+
+        /**
+         * @brief The index of the oldest event in the full ring buffer, which is overwritten next.
+         */
+        inline static int m_nextTraceEvent{ 0 };
+
+        /**
+         * @brief True while trace events are recorded; the startup is always recorded.
+         */
+        inline static bool m_recording{ true };
+
+        //-------------------------------------------------
+        // Helper
+        //-------------------------------------------------
+
+        [[nodiscard]] static int GetThreadIndex();
+        [[nodiscard]] static int64_t ToMicroseconds(Clock::time_point t_time);
+        static void AddTraceEvent(const TraceEvent& t_event);
+    };
+
+    //-------------------------------------------------
+    // ProfileScope
+    //-------------------------------------------------
+
+    /**
+     * @brief Measures the lifetime of a scope.
+     */
+    class ProfileScope
+    {
+    public:
+        //-------------------------------------------------
+        // Ctors. / Dtor.
+        //-------------------------------------------------
+
+        ProfileScope() = delete;
+
+        /**
+         * @brief Constructs a new ProfileScope object and starts the measurement.
+         *
+         * @param t_name The name of the scope; must be a string literal.
+         */
+        explicit ProfileScope(const std::string_view t_name)
+            : m_name{ t_name }
+            , m_start{ Profiler::Clock::now() }
+        {
+        }
+
+        ProfileScope(const ProfileScope& t_other) = delete;
+        ProfileScope(ProfileScope&& t_other) noexcept = delete;
+        ProfileScope& operator=(const ProfileScope& t_other) = delete;
+        ProfileScope& operator=(ProfileScope&& t_other) noexcept = delete;
+
+        ~ProfileScope() noexcept
+        {
+            Profiler::AddSample(m_name, m_start, Profiler::Clock::now());
+        }
+
+    protected:
+
+    private:
+        //-------------------------------------------------
+        // Member
+        //-------------------------------------------------
+
+        /**
+         * @brief The name of the scope.
+         */
+        std::string_view m_name;
+
+        /**
+         * @brief The start time.
+         */
+        Profiler::Clock::time_point m_start;
+    };
+}
+
+#define MDCII_PROFILE_CONCAT_IMPL(a, b)      a##b
+#define MDCII_PROFILE_CONCAT(a, b)           MDCII_PROFILE_CONCAT_IMPL(a, b)
+#define MDCII_PROFILE_SCOPE(name)            const ::mdcii::ProfileScope MDCII_PROFILE_CONCAT(profileScope, __LINE__){ name }
+#define MDCII_PROFILE_COUNTER(name, value)   ::mdcii::Profiler::AddCounter(name, static_cast<int64_t>(value))
+#define MDCII_PROFILE_NEW_FRAME()            ::mdcii::Profiler::NewFrame()
+#define MDCII_PROFILE_RENDER_IMGUI()         ::mdcii::Profiler::RenderImGui()
+
+#else
+
+#define MDCII_PROFILE_SCOPE(name)
+#define MDCII_PROFILE_COUNTER(name, value)
+#define MDCII_PROFILE_NEW_FRAME()
+#define MDCII_PROFILE_RENDER_IMGUI()
+
+#endif
@@ -46,21 +46,18 @@ mdcii::camera::Camera::~Camera() noexcept
 
 bool mdcii::camera::Camera::OnUserUpdate(const float t_elapsedTime)
 {
-    // the array containing the tiles currently being rendered must be updated
-    // if the flag is set
-    auto dirty{ false };
+    const auto lastZoom{ zoom };
+    const auto lastWorldPosition{ worldPosition };
 
     // zoom
     if (m_world->state->game->GetMouseWheel() > 0)
     {
         --zoom;
-        dirty = true;
         MDCII_LOG_DEBUG("[Camera::OnUserUpdate()] Zoom-- {}", magic_enum::enum_name(zoom));
     }
     if (m_world->state->game->GetMouseWheel() < 0)
     {
         ++zoom;
-        dirty = true;
         MDCII_LOG_DEBUG("[Camera::OnUserUpdate()] Zoom++ {}", magic_enum::enum_name(zoom));
     }
 
@@ -69,22 +66,18 @@ bool mdcii::camera::Camera::OnUserUpdate(const float t_elapsedTime)
     if (m_world->state->game->GetKey(olc::Key::UP).bHeld)
     {
         vel += { 0, -1 };
-        dirty = true;
     }
     if (m_world->state->game->GetKey(olc::Key::DOWN).bHeld)
     {
         vel += { 0, 1 };
-        dirty = true;
     }
     if (m_world->state->game->GetKey(olc::Key::LEFT).bHeld)
     {
         vel += { -1, 0 };
-        dirty = true;
     }
     if (m_world->state->game->GetKey(olc::Key::RIGHT).bHeld)
     {
         vel += { 1, 0 };
-        dirty = true;
     }
 
     origin.x += vel.x * t_elapsedTime * SPEED;
@@ -99,7 +92,8 @@ bool mdcii::camera::Camera::OnUserUpdate(const float t_elapsedTime)
     m_world->state->game->DrawString(4, 4, fmt::format("Camera world: {}, {}", std::to_string(worldPosition.x), std::to_string(worldPosition.y)), olc::WHITE);
     m_world->state->game->DrawString(4, 14, fmt::format("Camera screen: {}, {}", std::to_string(screenPosition.x), std::to_string(screenPosition.y)), olc::WHITE);
 
-    return dirty;
+    // the visible area only changes if the camera has moved to another tile or the zoom has changed
+    return zoom != lastZoom || worldPosition != lastWorldPosition;
 }
 
 //-------------------------------------------------
@@ -98,6 +98,13 @@ namespace mdcii::camera
         // Logic
         //-------------------------------------------------
 
+        /**
+         * @brief Moves and zooms the camera on user input.
+         *
+         * @param t_elapsedTime The time since the last frame.
+         *
+         * @return True if the camera moved to another tile or the zoom changed; otherwise false.
+         */
         [[nodiscard]] bool OnUserUpdate(float t_elapsedTime);
 
         //-------------------------------------------------
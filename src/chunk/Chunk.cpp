@@ -1,6 +1,6 @@
 // This file is part of the MDCII project.
 //
-// Copyright (c) 2023. stwe <https://github.com/stwe/MDCII>
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
 //
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -16,23 +16,35 @@
 // along with this program; if not, write to the Free Software
 // Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
 
-#include <fstream>
+#include <algorithm>
+#include <cstring>
 #include "Chunk.h"
+#include "MdciiException.h"
 
 //-------------------------------------------------
 // Ctors. / Dtor.
 //-------------------------------------------------
 
-mdcii::chunk::Chunk::Chunk(std::ifstream& t_input)
+mdcii::chunk::Chunk::Chunk(const std::span<const uint8_t> t_bytes)
 {
-    t_input.read(id.data(), ID_SIZE_IN_BYTES);
-    t_input.read(reinterpret_cast<char*>(&length), sizeof(length));
+    if (t_bytes.size() < HEADER_SIZE_IN_BYTES)
+    {
+        throw MDCII_EXCEPTION("[Chunk::Chunk()] Truncated Chunk header.");
+    }
+
+    // the Id is terminated by the first null byte, the rest is junk
+    const auto idBytes{ t_bytes.first(ID_SIZE_IN_BYTES) };
+    const auto idEnd{ std::ranges::find(idBytes, uint8_t{ 0 }) };
+    id.assign(idBytes.begin(), idEnd);
 
-    if (length > 0)
+    std::memcpy(&length, t_bytes.data() + ID_SIZE_IN_BYTES, sizeof(length));
+
+    if (length > t_bytes.size() - HEADER_SIZE_IN_BYTES)
     {
-        data.resize(length);
-        t_input.read(reinterpret_cast<char*>(data.data()), length);
+        throw MDCII_EXCEPTION("[Chunk::Chunk()] The data of Chunk " + id + " exceeds the file.");
     }
+
+    data = t_bytes.subspan(HEADER_SIZE_IN_BYTES, length);
 }
 
 mdcii::chunk::Chunk::~Chunk() noexcept
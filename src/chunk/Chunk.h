@@ -1,6 +1,6 @@
 // This file is part of the MDCII project.
 //
-// Copyright (c) 2023. stwe <https://github.com/stwe/MDCII>
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
 //
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -19,8 +19,8 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
 #include <string>
-#include <vector>
 
 //-------------------------------------------------
 // Chunk
@@ -35,10 +35,26 @@ namespace mdcii::chunk
      * The Chunk header consists of a type Id as an ASCII string that is padded with
      * junk to fill a full 16 bytes. Then comes a 4-byte integer that indicates the size
      * of the data block without the header.
+     *
+     * A Chunk does not own its data. It is a view into the content of a mapped file.
      */
     class Chunk
     {
     public:
+        //-------------------------------------------------
+        // Constants
+        //-------------------------------------------------
+
+        /**
+         * @brief The size in bytes of the Chunk type identifier.
+         */
+        static constexpr auto ID_SIZE_IN_BYTES{ 16 };
+
+        /**
+         * @brief The size in bytes of the Chunk header.
+         */
+        static constexpr auto HEADER_SIZE_IN_BYTES{ ID_SIZE_IN_BYTES + static_cast<int>(sizeof(uint32_t)) };
+
         //-------------------------------------------------
         // Member
         //-------------------------------------------------
@@ -56,7 +72,7 @@ namespace mdcii::chunk
         /**
          * @brief The Chunk data.
          */
-        std::vector<uint8_t> data;
+        std::span<const uint8_t> data;
 
         //-------------------------------------------------
         // Ctors. / Dtor.
@@ -65,29 +81,24 @@ namespace mdcii::chunk
         Chunk() = delete;
 
         /**
-         * @brief Constructs a new Chunk object.
+         * @brief Constructs a new Chunk object from the header at the beginning of the given bytes.
+         *
+         * Throws an exception if the header or the data block exceeds the given bytes.
          *
-         * @param t_input The content of a file.
+         * @param t_bytes The content of a file from the beginning of the Chunk to the end of the file.
          */
-        explicit Chunk(std::ifstream& t_input);
+        explicit Chunk(std::span<const uint8_t> t_bytes);
 
-        Chunk(const Chunk& t_other) = delete;
-        Chunk(Chunk&& t_other) noexcept = delete;
-        Chunk& operator=(const Chunk& t_other) = delete;
-        Chunk& operator=(Chunk&& t_other) noexcept = delete;
+        Chunk(const Chunk& t_other) = default;
+        Chunk(Chunk&& t_other) noexcept = default;
+        Chunk& operator=(const Chunk& t_other) = default;
+        Chunk& operator=(Chunk&& t_other) noexcept = default;
 
         ~Chunk() noexcept;
 
     protected:
 
     private:
-        //-------------------------------------------------
-        // Constants
-        //-------------------------------------------------
 
-        /**
-         * @brief The size in bytes of the Chunk type identifier.
-         */
-        static constexpr auto ID_SIZE_IN_BYTES{ 16 };
     };
 }
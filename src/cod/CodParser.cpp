@@ -20,10 +20,14 @@
 #include <regex>
 #include <google/protobuf/util/json_util.h>
 #include "CodParser.h"
+#include "Profiler.h"
 #include "CodHelper.h"
 #include "Game.h"
 #include "Log.h"
 #include "MdciiException.h"
+#include "MdciiUtils.h"
+#include "resource/AssetCache.h"
+#include "resource/MappedFile.h"
 
 //-------------------------------------------------
 // Ctors. / Dtor.
@@ -38,14 +42,25 @@ mdcii::cod::CodParser::CodParser(std::string t_codFilePath, const bool t_decode)
     auto filenameOnly{ p.stem().string() };
     m_jsonPath = Game::RESOURCES_REL_PATH + filenameOnly.append(".json");
 
-    if (std::filesystem::exists(m_jsonPath))
+    // without the original file only the Json file can be read
+    if (!std::filesystem::exists(m_path) && std::filesystem::exists(m_jsonPath))
     {
         Deserialize();
         return;
     }
 
+    const resource::MappedFile codFile{ m_path };
+    const uint8_t decode{ t_decode };
+    const auto key{ resource::AssetCache::CreateKey({ codFile.GetData(), { &decode, 1 } }) };
+
+    if (LoadCache(key))
+    {
+        return;
+    }
+
     ReadFile(t_decode);
     ParseFile();
+    StoreCache(key);
 }
 
 mdcii::cod::CodParser::~CodParser() noexcept
@@ -111,6 +126,8 @@ bool mdcii::cod::CodParser::ReadFile(const bool t_decode)
 
 void mdcii::cod::CodParser::ParseFile()
 {
+    MDCII_PROFILE_SCOPE("CodParser::ParseFile");
+
     std::map<std::string, int> variableNumbers;
     std::map<std::string, std::vector<int>> variableNumbersArray;
 
@@ -626,6 +643,49 @@ void mdcii::cod::CodParser::Deserialize()
     MDCII_LOG_DEBUG("[CodParser::Deserialize()] The Json file was readed successfully.");
 }
 
+//-------------------------------------------------
+// Cache
+//-------------------------------------------------
+
+bool mdcii::cod::CodParser::LoadCache(const uint64_t t_key)
+{
+    const auto entry{ resource::AssetCache::Load(GetCacheName(), t_key) };
+    if (!entry)
+    {
+        return false;
+    }
+
+    const auto payload{ resource::AssetCache::GetPayload(*entry) };
+    if (!objects.ParseFromArray(payload.data(), static_cast<int>(payload.size())))
+    {
+        MDCII_LOG_WARN("[CodParser::LoadCache()] The cached Cod objects of {} could not be read.", m_path);
+        objects.Clear();
+
+        return false;
+    }
+
+    MDCII_LOG_DEBUG("[CodParser::LoadCache()] The Cod objects of {} were read from the cache.", m_path);
+
+    return true;
+}
+
+void mdcii::cod::CodParser::StoreCache(const uint64_t t_key) const
+{
+    std::string bytes;
+    if (!objects.SerializeToString(&bytes))
+    {
+        MDCII_LOG_WARN("[CodParser::StoreCache()] The Cod objects of {} could not be serialized.", m_path);
+        return;
+    }
+
+    resource::AssetCache::Store(GetCacheName(), t_key, { reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size() });
+}
+
+std::string mdcii::cod::CodParser::GetCacheName() const
+{
+    return to_lower_case(std::filesystem::path(m_path).stem().string());
+}
+
 //-------------------------------------------------
 // Object related functions
 //-------------------------------------------------
@@ -62,6 +62,14 @@ namespace mdcii::cod
         void Json() const;
         void Deserialize();
 
+        //-------------------------------------------------
+        // Cache
+        //-------------------------------------------------
+
+        bool LoadCache(uint64_t t_key);
+        void StoreCache(uint64_t t_key) const;
+        std::string GetCacheName() const;
+
         //-------------------------------------------------
         // Object related functions
         //-------------------------------------------------
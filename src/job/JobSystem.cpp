@@ -0,0 +1,161 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#include <algorithm>
+#include "JobSystem.h"
+#include "MdciiAssert.h"
+
+//-------------------------------------------------
+// Ctors. / Dtor.
+//-------------------------------------------------
+
+mdcii::job::JobSystem::JobSystem()
+    : JobSystem(std::max(1, static_cast<int>(std::thread::hardware_concurrency())) - 1)
+{
+}
+
+mdcii::job::JobSystem::JobSystem(const int t_nrOfWorkers)
+{
+    MDCII_LOG_DEBUG("[JobSystem::JobSystem()] Create JobSystem with {} workers.", t_nrOfWorkers);
+
+    MDCII_ASSERT(t_nrOfWorkers >= 0, "[JobSystem::JobSystem()] Invalid number of workers.")
+
+    m_workers.reserve(t_nrOfWorkers);
+    for (auto i{ 0 }; i < t_nrOfWorkers; ++i)
+    {
+        m_workers.emplace_back(&JobSystem::WorkerLoop, this);
+    }
+}
+
+mdcii::job::JobSystem::~JobSystem() noexcept
+{
+    MDCII_LOG_DEBUG("[JobSystem::~JobSystem()] Destruct JobSystem.");
+
+    {
+        std::lock_guard lock{ m_mutex };
+        m_stop = true;
+    }
+    m_wakeCondition.notify_all();
+
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+//-------------------------------------------------
+// Logic
+//-------------------------------------------------
+
+void mdcii::job::JobSystem::ParallelFor(const int t_count, const std::function<void(int)>& t_func)
+{
+    if (t_count <= 0)
+    {
+        return;
+    }
+
+    // not worth waking the workers
+    if (m_workers.empty() || t_count == 1)
+    {
+        for (auto i{ 0 }; i < t_count; ++i)
+        {
+            t_func(i);
+        }
+
+        return;
+    }
+
+    {
+        std::lock_guard lock{ m_mutex };
+        m_func = &t_func;
+        m_count = t_count;
+        m_nextIndex = 0;
+        m_nrOfBusyWorkers = static_cast<int>(m_workers.size());
+        ++m_generation;
+    }
+    m_wakeCondition.notify_all();
+
+    RunJobs();
+
+    std::exception_ptr exception;
+    {
+        std::unique_lock lock{ m_mutex };
+        m_doneCondition.wait(lock, [this] { return m_nrOfBusyWorkers == 0; });
+
+        m_func = nullptr;
+        std::swap(exception, m_exception);
+    }
+
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+}
+
+//-------------------------------------------------
+// Helper
+//-------------------------------------------------
+
+void mdcii::job::JobSystem::WorkerLoop()
+{
+    uint64_t generation{ 0 };
+
+    while (true)
+    {
+        {
+            std::unique_lock lock{ m_mutex };
+            m_wakeCondition.wait(lock, [&] { return m_stop || m_generation != generation; });
+
+            if (m_stop)
+            {
+                return;
+            }
+
+            generation = m_generation;
+        }
+
+        RunJobs();
+
+        {
+            std::lock_guard lock{ m_mutex };
+            if (--m_nrOfBusyWorkers == 0)
+            {
+                m_doneCondition.notify_one();
+            }
+        }
+    }
+}
+
+void mdcii::job::JobSystem::RunJobs()
+{
+    for (auto i{ m_nextIndex.fetch_add(1) }; i < m_count; i = m_nextIndex.fetch_add(1))
+    {
+        try
+        {
+            (*m_func)(i);
+        }
+        catch (...)
+        {
+            std::lock_guard lock{ m_mutex };
+            if (!m_exception)
+            {
+                m_exception = std::current_exception();
+            }
+        }
+    }
+}
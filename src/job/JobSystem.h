@@ -0,0 +1,169 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mdcii::job
+{
+    //-------------------------------------------------
+    // JobSystem
+    //-------------------------------------------------
+
+    /**
+     * @brief A pool of worker threads that run independent jobs.
+     *
+     * The calling thread takes part in the work and waits until all jobs are done.
+     * Jobs must not call the JobSystem themselves.
+     */
+    class JobSystem
+    {
+    public:
+        //-------------------------------------------------
+        // Ctors. / Dtor.
+        //-------------------------------------------------
+
+        /**
+         * @brief Constructs a new JobSystem object with a worker for each additional hardware thread.
+         */
+        JobSystem();
+
+        /**
+         * @brief Constructs a new JobSystem object.
+         *
+         * @param t_nrOfWorkers The number of worker threads besides the calling thread.
+         */
+        explicit JobSystem(int t_nrOfWorkers);
+
+        JobSystem(const JobSystem& t_other) = delete;
+        JobSystem(JobSystem&& t_other) noexcept = delete;
+        JobSystem& operator=(const JobSystem& t_other) = delete;
+        JobSystem& operator=(JobSystem&& t_other) noexcept = delete;
+
+        ~JobSystem() noexcept;
+
+        //-------------------------------------------------
+        // Logic
+        //-------------------------------------------------
+
+        /**
+         * @brief Calls a function for each index in [0, t_count) on the workers and the calling thread.
+         *
+         * Returns when all calls have finished. The first exception thrown by a call is rethrown.
+         *
+         * @param t_count The number of jobs.
+         * @param t_func The function to call with the index of a job.
+         */
+        void ParallelFor(int t_count, const std::function<void(int)>& t_func);
+
+        //-------------------------------------------------
+        // Getter
+        //-------------------------------------------------
+
+        /**
+         * @brief Getter for the number of threads running jobs, including the calling thread.
+         *
+         * @return The number of threads.
+         */
+        [[nodiscard]] int GetNrOfThreads() const { return static_cast<int>(m_workers.size()) + 1; }
+
+    protected:
+
+    private:
+        //-------------------------------------------------
+        // Member
+        //-------------------------------------------------
+
+        /**
+         * @brief The worker threads.
+         */
+        std::vector<std::thread> m_workers;
+
+        /**
+         * @brief Protects the state shared with the workers.
+         */
+        std::mutex m_mutex;
+
+        /**
+         * @brief Wakes the workers when new jobs are available or the JobSystem stops.
+         */
+        std::condition_variable m_wakeCondition;
+
+        /**
+         * @brief Wakes the calling thread when all workers are done.
+         */
+        std::condition_variable m_doneCondition;
+
+        /**
+         * @brief The function of the current jobs.
+         */
+        const std::function<void(int)>* m_func{ nullptr };
+
+        /**
+         * @brief The number of the current jobs.
+         */
+        int m_count{ 0 };
+
+        /**
+         * @brief The index of the next job to run.
+         */
+        std::atomic<int> m_nextIndex{ 0 };
+
+        /**
+         * @brief The number of workers that have not yet finished the current jobs.
+         */
+        int m_nrOfBusyWorkers{ 0 };
+
+        /**
+         * @brief Incremented for each `ParallelFor()` call with work for the workers.
+         */
+        uint64_t m_generation{ 0 };
+
+        /**
+         * @brief True if the workers should exit.
+         */
+        bool m_stop{ false };
+
+        /**
+         * @brief The first exception thrown by a job.
+         */
+        std::exception_ptr m_exception;
+
+        //-------------------------------------------------
+        // Helper
+        //-------------------------------------------------
+
+        /**
+         * @brief The loop of a worker thread.
+         */
+        void WorkerLoop();
+
+        /**
+         * @brief Runs jobs until there are no more left.
+         */
+        void RunJobs();
+    };
+}
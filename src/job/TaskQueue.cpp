@@ -0,0 +1,89 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#include <algorithm>
+#include "TaskQueue.h"
+#include "MdciiAssert.h"
+
+//-------------------------------------------------
+// Ctors. / Dtor.
+//-------------------------------------------------
+
+mdcii::job::TaskQueue::TaskQueue()
+    : TaskQueue(std::max(1, static_cast<int>(std::thread::hardware_concurrency()) / 2))
+{
+}
+
+mdcii::job::TaskQueue::TaskQueue(const int t_nrOfWorkers)
+{
+    MDCII_LOG_DEBUG("[TaskQueue::TaskQueue()] Create TaskQueue with {} workers.", t_nrOfWorkers);
+
+    MDCII_ASSERT(t_nrOfWorkers > 0, "[TaskQueue::TaskQueue()] Invalid number of workers.")
+
+    m_workers.reserve(t_nrOfWorkers);
+    for (auto i{ 0 }; i < t_nrOfWorkers; ++i)
+    {
+        m_workers.emplace_back(&TaskQueue::WorkerLoop, this);
+    }
+}
+
+mdcii::job::TaskQueue::~TaskQueue() noexcept
+{
+    MDCII_LOG_DEBUG("[TaskQueue::~TaskQueue()] Destruct TaskQueue.");
+
+    // the tasks not yet started are dropped, so their futures report a broken promise
+    {
+        std::lock_guard lock{ m_mutex };
+        m_stop = true;
+        m_tasks.clear();
+    }
+    m_wakeCondition.notify_all();
+
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+//-------------------------------------------------
+// Helper
+//-------------------------------------------------
+
+void mdcii::job::TaskQueue::WorkerLoop()
+{
+    while (true)
+    {
+        std::function<void()> task;
+
+        {
+            std::unique_lock lock{ m_mutex };
+            m_wakeCondition.wait(lock, [this] { return m_stop || !m_tasks.empty(); });
+
+            if (m_stop)
+            {
+                return;
+            }
+
+            task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+        }
+
+        // a packaged_task stores an exception in its future
+        task();
+    }
+}
@@ -0,0 +1,138 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace mdcii::job
+{
+    //-------------------------------------------------
+    // TaskQueue
+    //-------------------------------------------------
+
+    /**
+     * @brief A few long-lived worker threads that run tasks in the background.
+     *
+     * Unlike the JobSystem, the calling thread does not wait. The tasks are run in the
+     * order they were pushed and their results are returned through futures.
+     */
+    class TaskQueue
+    {
+    public:
+        //-------------------------------------------------
+        // Ctors. / Dtor.
+        //-------------------------------------------------
+
+        /**
+         * @brief Constructs a new TaskQueue object with a worker for every second hardware thread.
+         */
+        TaskQueue();
+
+        /**
+         * @brief Constructs a new TaskQueue object.
+         *
+         * @param t_nrOfWorkers The number of worker threads.
+         */
+        explicit TaskQueue(int t_nrOfWorkers);
+
+        TaskQueue(const TaskQueue& t_other) = delete;
+        TaskQueue(TaskQueue&& t_other) noexcept = delete;
+        TaskQueue& operator=(const TaskQueue& t_other) = delete;
+        TaskQueue& operator=(TaskQueue&& t_other) noexcept = delete;
+
+        ~TaskQueue() noexcept;
+
+        //-------------------------------------------------
+        // Logic
+        //-------------------------------------------------
+
+        /**
+         * @brief Pushes a task to be run on a worker.
+         *
+         * @tparam F The type of the task.
+         *
+         * @param t_func The task.
+         *
+         * @return A future for the result of the task.
+         */
+        template <typename F>
+        std::future<std::invoke_result_t<F>> Push(F&& t_func)
+        {
+            auto task{ std::make_shared<std::packaged_task<std::invoke_result_t<F>()>>(std::forward<F>(t_func)) };
+            auto future{ task->get_future() };
+
+            {
+                std::lock_guard lock{ m_mutex };
+                m_tasks.emplace_back([task] { (*task)(); });
+            }
+            m_wakeCondition.notify_one();
+
+            return future;
+        }
+
+    protected:
+
+    private:
+        //-------------------------------------------------
+        // Member
+        //-------------------------------------------------
+
+        /**
+         * @brief The worker threads.
+         */
+        std::vector<std::thread> m_workers;
+
+        /**
+         * @brief Protects the tasks and the stop flag.
+         */
+        std::mutex m_mutex;
+
+        /**
+         * @brief Wakes the workers when a task is pushed or the TaskQueue stops.
+         */
+        std::condition_variable m_wakeCondition;
+
+        /**
+         * @brief The tasks that have not been started yet.
+         */
+        std::deque<std::function<void()>> m_tasks;
+
+        /**
+         * @brief True if the workers should exit.
+         */
+        bool m_stop{ false };
+
+        //-------------------------------------------------
+        // Helper
+        //-------------------------------------------------
+
+        /**
+         * @brief The loop of a worker thread.
+         */
+        void WorkerLoop();
+    };
+}
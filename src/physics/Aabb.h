@@ -95,5 +95,21 @@ namespace mdcii::physics
                 t_a.position.y < t_b.position.y + t_b.size.y &&
                 t_a.position.y + t_a.size.y > t_b.position.y;
         }
+
+        /**
+         * @brief The overlapping area of two Aabbs.
+         *
+         * @param t_a An Aabb.
+         * @param t_b Another Aabb.
+         *
+         * @return The overlapping area; its size is not positive if there is no collision.
+         */
+        static Aabb Intersection(const Aabb& t_a, const Aabb& t_b)
+        {
+            const auto position{ t_a.position.max(t_b.position) };
+            const auto end{ (t_a.position + t_a.size).min(t_b.position + t_b.size) };
+
+            return { position, end - position };
+        }
     };
 }
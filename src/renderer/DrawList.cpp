@@ -0,0 +1,334 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#include <algorithm>
+#include "DrawList.h"
+#include "Profiler.h"
+#include "Game.h"
+#include "MdciiAssert.h"
+#include "world/World.h"
+#include "state/State.h"
+
+//-------------------------------------------------
+// Ctors. / Dtor.
+//-------------------------------------------------
+
+mdcii::renderer::DrawList::DrawList()
+{
+    MDCII_LOG_DEBUG("[DrawList::DrawList()] Create recording DrawList.");
+}
+
+mdcii::renderer::DrawList::DrawList(const world::World* t_world)
+    : m_world{ t_world }
+{
+    MDCII_LOG_DEBUG("[DrawList::DrawList()] Create DrawList.");
+
+    MDCII_ASSERT(m_world, "[DrawList::DrawList()] Null pointer.")
+}
+
+mdcii::renderer::DrawList::~DrawList() noexcept
+{
+    MDCII_LOG_DEBUG("[DrawList::~DrawList()] Destruct DrawList.");
+}
+
+//-------------------------------------------------
+// Logic
+//-------------------------------------------------
+
+int mdcii::renderer::DrawList::Add(
+    const olc::vf2d& t_position,
+    olc::Decal* t_decal,
+    const olc::vf2d& t_sourcePos,
+    const olc::vf2d& t_sourceSize,
+    const olc::Pixel& t_tint
+)
+{
+    if (!t_decal)
+    {
+        return -1;
+    }
+
+    // the same small inset as olc::PixelGameEngine::DrawPartialDecal() to avoid bleeding
+    const olc::vf2d inset{ 0.0001f, 0.0001f };
+
+    m_commands.push_back({
+        t_decal,
+        t_position,
+        t_sourceSize,
+        (t_sourcePos + inset) * t_decal->vUVScale,
+        (t_sourcePos + t_sourceSize - inset) * t_decal->vUVScale,
+        t_tint
+    });
+
+    return static_cast<int>(m_commands.size()) - 1;
+}
+
+int mdcii::renderer::DrawList::Add(const olc::vf2d& t_position, olc::Decal* t_decal, const olc::Pixel& t_tint)
+{
+    if (!t_decal)
+    {
+        return -1;
+    }
+
+    return Add(
+        t_position,
+        t_decal,
+        { 0.0f, 0.0f },
+        { static_cast<float>(t_decal->sprite->width), static_cast<float>(t_decal->sprite->height) },
+        t_tint
+    );
+}
+
+void mdcii::renderer::DrawList::Update(
+    const int t_index,
+    const olc::vf2d& t_position,
+    olc::Decal* t_decal,
+    const olc::vf2d& t_sourcePos
+)
+{
+    MDCII_ASSERT(t_index >= 0 && t_index < m_nrOfRetainedCommands, "[DrawList::Update()] Invalid index.")
+    MDCII_ASSERT(t_decal, "[DrawList::Update()] Null pointer.")
+
+    const olc::vf2d inset{ 0.0001f, 0.0001f };
+
+    auto& command{ m_commands[t_index] };
+    command.uvTopLeft = (t_sourcePos + inset) * t_decal->vUVScale;
+    command.uvBottomRight = (t_sourcePos + command.size - inset) * t_decal->vUVScale;
+
+    // another decal or position can change the batches
+    if (command.decal != t_decal || command.position != t_position)
+    {
+        command.decal = t_decal;
+        command.position = t_position;
+        m_batchesDirty = true;
+
+        return;
+    }
+
+    if (!m_batchesDirty)
+    {
+        WriteUvs(&m_batches[command.batch].uvs[command.vertex], command);
+    }
+}
+
+int mdcii::renderer::DrawList::Append(const DrawList& t_other)
+{
+    const auto first{ static_cast<int>(m_commands.size()) };
+    m_commands.insert(m_commands.end(), t_other.m_commands.begin(), t_other.m_commands.end());
+
+    return first;
+}
+
+void mdcii::renderer::DrawList::Replace(const int t_first, const int t_count, const DrawList& t_other)
+{
+    MDCII_ASSERT(t_first >= 0 && t_count >= 0 && t_first + t_count <= m_nrOfRetainedCommands, "[DrawList::Replace()] Invalid range.")
+
+    const auto& newCommands{ t_other.m_commands };
+    const auto nrOfNewCommands{ static_cast<int>(newCommands.size()) };
+    const auto nrOfCopies{ std::min(t_count, nrOfNewCommands) };
+
+    // the draws are overwritten in place as far as possible
+    const auto first{ m_commands.begin() + t_first };
+    std::copy_n(newCommands.begin(), nrOfCopies, first);
+    if (nrOfNewCommands > t_count)
+    {
+        m_commands.insert(first + nrOfCopies, newCommands.begin() + nrOfCopies, newCommands.end());
+    }
+    else
+    {
+        m_commands.erase(first + nrOfCopies, first + t_count);
+    }
+
+    m_nrOfRetainedCommands += nrOfNewCommands - t_count;
+    m_batchesDirty = true;
+}
+
+void mdcii::renderer::DrawList::Retain()
+{
+    m_nrOfRetainedCommands = static_cast<int>(m_commands.size());
+    m_batchesDirty = true;
+}
+
+void mdcii::renderer::DrawList::Clear()
+{
+    m_commands.clear();
+    m_nrOfRetainedCommands = 0;
+    m_batchesDirty = true;
+}
+
+void mdcii::renderer::DrawList::Submit()
+{
+    MDCII_PROFILE_SCOPE("DrawList::Submit");
+
+    MDCII_ASSERT(m_world, "[DrawList::Submit()] A recording DrawList cannot be submitted.")
+
+    m_nrOfSubmittedBatches = 0;
+    if (m_commands.empty())
+    {
+        return;
+    }
+
+    // the batches of the retained draws are reused until a retained draw changes its decal or position
+    if (m_batchesDirty)
+    {
+        m_nrOfBatches = 0;
+        CreateBatches(0, m_nrOfRetainedCommands);
+        m_nrOfRetainedBatches = m_nrOfBatches;
+        m_batchesDirty = false;
+    }
+
+    // the other draws are painted last, so they get their own batches after the retained ones
+    CreateBatches(m_nrOfRetainedCommands, static_cast<int>(m_commands.size()));
+
+    auto* game{ m_world->state->game };
+    game->SetDecalStructure(olc::DecalStructure::LIST);
+
+    for (auto b{ 0 }; b < m_nrOfBatches; ++b)
+    {
+        const auto& batch{ m_batches[b] };
+        game->DrawPolygonDecal(batch.decal, batch.positions, batch.uvs, batch.tints);
+    }
+
+    game->SetDecalStructure(olc::DecalStructure::FAN);
+
+    MDCII_PROFILE_COUNTER("Draws submitted", m_commands.size());
+    MDCII_PROFILE_COUNTER("Decal instances submitted", m_nrOfBatches);
+
+    m_nrOfSubmittedBatches = m_nrOfBatches;
+    m_commands.resize(m_nrOfRetainedCommands);
+    m_nrOfBatches = m_nrOfRetainedBatches;
+}
+
+//-------------------------------------------------
+// Helper
+//-------------------------------------------------
+
+void mdcii::renderer::DrawList::CreateBatches(const int t_firstCommand, const int t_endCommand)
+{
+    const auto firstBatch{ m_nrOfBatches };
+
+    for (auto c{ t_firstCommand }; c < t_endCommand; ++c)
+    {
+        const auto& command{ m_commands[c] };
+
+        // search backwards for a batch of the same decal; a draw must not be moved
+        // before a draw it overlaps
+        auto target{ -1 };
+        for (auto b{ m_nrOfBatches - 1 }; b >= firstBatch && b >= m_nrOfBatches - MAX_LOOKBACK_BATCHES; --b)
+        {
+            if (m_batches[b].decal == command.decal)
+            {
+                target = b;
+                break;
+            }
+
+            if (Overlaps(m_batches[b], command))
+            {
+                break;
+            }
+        }
+
+        if (target < 0)
+        {
+            if (m_nrOfBatches == static_cast<int>(m_batches.size()))
+            {
+                m_batches.emplace_back();
+            }
+
+            target = m_nrOfBatches++;
+            auto& batch{ m_batches[target] };
+            batch.commands.clear();
+            batch.decal = command.decal;
+            batch.min = command.position;
+            batch.max = command.position + command.size;
+        }
+
+        auto& batch{ m_batches[target] };
+        batch.min = batch.min.min(command.position);
+        batch.max = batch.max.max(command.position + command.size);
+        batch.commands.push_back(c);
+    }
+
+    // two triangles for each draw
+    for (auto b{ firstBatch }; b < m_nrOfBatches; ++b)
+    {
+        auto& batch{ m_batches[b] };
+        const auto nrOfVertices{ batch.commands.size() * 6 };
+
+        batch.positions.resize(nrOfVertices);
+        batch.uvs.resize(nrOfVertices);
+        batch.tints.resize(nrOfVertices);
+
+        auto vertex{ 0 };
+        for (const auto c : batch.commands)
+        {
+            auto& command{ m_commands[c] };
+            command.batch = b;
+            command.vertex = vertex;
+
+            const auto& position{ command.position };
+            const olc::vf2d bottomRight{ position + command.size };
+
+            auto* positions{ &batch.positions[vertex] };
+            positions[0] = position;
+            positions[1] = { position.x, bottomRight.y };
+            positions[2] = bottomRight;
+            positions[3] = position;
+            positions[4] = bottomRight;
+            positions[5] = { bottomRight.x, position.y };
+
+            WriteUvs(&batch.uvs[vertex], command);
+            std::fill_n(batch.tints.begin() + vertex, 6, command.tint);
+
+            vertex += 6;
+        }
+    }
+}
+
+void mdcii::renderer::DrawList::WriteUvs(olc::vf2d* t_uvs, const DrawCommand& t_command)
+{
+    const auto& uvTopLeft{ t_command.uvTopLeft };
+    const auto& uvBottomRight{ t_command.uvBottomRight };
+
+    t_uvs[0] = uvTopLeft;
+    t_uvs[1] = { uvTopLeft.x, uvBottomRight.y };
+    t_uvs[2] = uvBottomRight;
+    t_uvs[3] = uvTopLeft;
+    t_uvs[4] = uvBottomRight;
+    t_uvs[5] = { uvBottomRight.x, uvTopLeft.y };
+}
+
+bool mdcii::renderer::DrawList::Overlaps(const Batch& t_batch, const DrawCommand& t_command) const
+{
+    const auto intersects{ [&t_command](const olc::vf2d& t_min, const olc::vf2d& t_max)
+    {
+        return t_command.position.x < t_max.x && t_command.position.x + t_command.size.x > t_min.x &&
+               t_command.position.y < t_max.y && t_command.position.y + t_command.size.y > t_min.y;
+    } };
+
+    if (!intersects(t_batch.min, t_batch.max))
+    {
+        return false;
+    }
+
+    return std::ranges::any_of(t_batch.commands, [&](const int t_c)
+    {
+        const auto& other{ m_commands[t_c] };
+        return intersects(other.position, other.position + other.size);
+    });
+}
@@ -0,0 +1,308 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#pragma once
+
+#include <vector>
+#include "vendor/olc/olcPixelGameEngine.h"
+
+//-------------------------------------------------
+// Forward declarations
+//-------------------------------------------------
+
+namespace mdcii::world
+{
+    /**
+     * @brief Forward declaration class World.
+     */
+    class World;
+}
+
+namespace mdcii::renderer
+{
+    //-------------------------------------------------
+    // DrawList
+    //-------------------------------------------------
+
+    /**
+     * @brief Collects the partial decals of the world and submits them batched by decal.
+     *
+     * The order of the `Add()` calls is the painter order. When submitting, a draw is moved
+     * into an earlier batch of the same decal as long as it does not overlap any draw
+     * between them. Each batch is submitted as a single decal instance with a triangle list.
+     *
+     * The draws added before `Retain()` are kept over several frames together with their
+     * batches and vertices. They can be patched with `Update()` until the next `Clear()`.
+     * Draws added after `Retain()` are only submitted once. They are painted last, so they
+     * get their own batches after the retained ones, which are kept unchanged.
+     */
+    class DrawList
+    {
+    public:
+        //-------------------------------------------------
+        // Ctors. / Dtor.
+        //-------------------------------------------------
+
+        /**
+         * @brief Constructs a new DrawList object that only records draws to append them to another DrawList.
+         */
+        DrawList();
+
+        /**
+         * @brief Constructs a new DrawList object.
+         *
+         * @param t_world Pointer to the parent World object.
+         */
+        explicit DrawList(const world::World* t_world);
+
+        DrawList(const DrawList& t_other) = delete;
+        DrawList(DrawList&& t_other) noexcept = delete;
+        DrawList& operator=(const DrawList& t_other) = delete;
+        DrawList& operator=(DrawList&& t_other) noexcept = delete;
+
+        ~DrawList() noexcept;
+
+        //-------------------------------------------------
+        // Logic
+        //-------------------------------------------------
+
+        /**
+         * @brief Adds a region of a decal.
+         *
+         * @param t_position The screen position.
+         * @param t_decal The decal.
+         * @param t_sourcePos The top left position of the region in the decal.
+         * @param t_sourceSize The size of the region.
+         * @param t_tint Color tint.
+         *
+         * @return The index of the draw or -1 if there is no decal.
+         */
+        int Add(const olc::vf2d& t_position, olc::Decal* t_decal, const olc::vf2d& t_sourcePos, const olc::vf2d& t_sourceSize, const olc::Pixel& t_tint);
+
+        /**
+         * @brief Adds a whole decal.
+         *
+         * @param t_position The screen position.
+         * @param t_decal The decal.
+         * @param t_tint Color tint.
+         *
+         * @return The index of the draw or -1 if there is no decal.
+         */
+        int Add(const olc::vf2d& t_position, olc::Decal* t_decal, const olc::Pixel& t_tint);
+
+        /**
+         * @brief Changes the region and the position of a retained draw.
+         *
+         * Only the texture coordinates are patched as long as the decal and the position are unchanged.
+         * Otherwise, the batches are created again with the next `Submit()`.
+         *
+         * @param t_index The index of the draw.
+         * @param t_position The new screen position.
+         * @param t_decal The new decal.
+         * @param t_sourcePos The new top left position of the region in the decal.
+         */
+        void Update(int t_index, const olc::vf2d& t_position, olc::Decal* t_decal, const olc::vf2d& t_sourcePos);
+
+        /**
+         * @brief Adds the draws of another DrawList.
+         *
+         * @param t_other The DrawList with the draws to add.
+         *
+         * @return The index of the first added draw.
+         */
+        int Append(const DrawList& t_other);
+
+        /**
+         * @brief Replaces a range of retained draws with the draws of another DrawList.
+         *
+         * The batches are created again with the next `Submit()`.
+         *
+         * @param t_first The index of the first draw to replace.
+         * @param t_count The number of draws to replace.
+         * @param t_other The DrawList with the new draws.
+         */
+        void Replace(int t_first, int t_count, const DrawList& t_other);
+
+        /**
+         * @brief Keeps all draws added so far for the next frames.
+         */
+        void Retain();
+
+        /**
+         * @brief Removes all draws including the retained ones.
+         */
+        void Clear();
+
+        /**
+         * @brief Submits all draws to the engine and removes the draws that are not retained.
+         */
+        void Submit();
+
+        //-------------------------------------------------
+        // Types
+        //-------------------------------------------------
+
+        /**
+         * @brief A region of a decal on the screen.
+         */
+        struct DrawCommand
+        {
+            olc::Decal* decal{ nullptr };
+            olc::vf2d position;
+            olc::vf2d size;
+            olc::vf2d uvTopLeft;
+            olc::vf2d uvBottomRight;
+            olc::Pixel tint;
+
+            /**
+             * @brief The batch and the first vertex in it from the last batching.
+             */
+            int batch{ -1 };
+            int vertex{ -1 };
+        };
+
+        //-------------------------------------------------
+        // Getter
+        //-------------------------------------------------
+
+        /**
+         * @brief Getter for the draws in painter order.
+         *
+         * @return The draws.
+         */
+        [[nodiscard]] const std::vector<DrawCommand>& GetCommands() const { return m_commands; }
+
+        /**
+         * @brief Getter for the number of retained draws.
+         *
+         * @return The number of retained draws.
+         */
+        [[nodiscard]] int GetNrOfRetainedCommands() const { return m_nrOfRetainedCommands; }
+
+        /**
+         * @brief Getter for the number of decal instances created by the last `Submit()`.
+         *
+         * @return The number of decal instances.
+         */
+        [[nodiscard]] int GetNrOfSubmittedBatches() const { return m_nrOfSubmittedBatches; }
+
+    protected:
+
+    private:
+        //-------------------------------------------------
+        // Types
+        //-------------------------------------------------
+
+        /**
+         * @brief The draws of the same decal that can be submitted together.
+         */
+        struct Batch
+        {
+            olc::Decal* decal{ nullptr };
+            olc::vf2d min;
+            olc::vf2d max;
+            std::vector<int> commands;
+            std::vector<olc::vf2d> positions;
+            std::vector<olc::vf2d> uvs;
+            std::vector<olc::Pixel> tints;
+        };
+
+        //-------------------------------------------------
+        // Constants
+        //-------------------------------------------------
+
+        /**
+         * @brief The maximum number of batches a draw can be moved back.
+         */
+        static constexpr auto MAX_LOOKBACK_BATCHES{ 16 };
+
+        //-------------------------------------------------
+        // Member
+        //-------------------------------------------------
+
+        /**
+         * @brief Pointer to the parent World object or nullptr if the draws are only recorded.
+         */
+        const world::World* m_world{ nullptr };
+
+        /**
+         * @brief The draws in painter order.
+         */
+        std::vector<DrawCommand> m_commands;
+
+        /**
+         * @brief The batches; only the first `m_nrOfBatches` are in use, the others keep their memory.
+         */
+        std::vector<Batch> m_batches;
+
+        /**
+         * @brief The number of batches in use.
+         */
+        int m_nrOfBatches{ 0 };
+
+        /**
+         * @brief The number of batches at the front of `m_batches` that belong to the retained draws.
+         */
+        int m_nrOfRetainedBatches{ 0 };
+
+        /**
+         * @brief The number of draws at the front of `m_commands` that are kept over several frames.
+         */
+        int m_nrOfRetainedCommands{ 0 };
+
+        /**
+         * @brief True if the batches no longer match the retained draws.
+         */
+        bool m_batchesDirty{ true };
+
+        /**
+         * @brief The number of decal instances created by the last `Submit()`.
+         */
+        int m_nrOfSubmittedBatches{ 0 };
+
+        //-------------------------------------------------
+        // Helper
+        //-------------------------------------------------
+
+        /**
+         * @brief Distributes a range of draws to new batches after the batches in use and creates their vertices.
+         *
+         * @param t_firstCommand The index of the first draw.
+         * @param t_endCommand The index after the last draw.
+         */
+        void CreateBatches(int t_firstCommand, int t_endCommand);
+
+        /**
+         * @brief Writes the texture coordinates of the two triangles of a draw.
+         *
+         * @param t_uvs The first of the six texture coordinates.
+         * @param t_command The draw.
+         */
+        static void WriteUvs(olc::vf2d* t_uvs, const DrawCommand& t_command);
+
+        /**
+         * @brief Checks whether a draw overlaps any draw of a batch.
+         *
+         * @param t_batch The batch.
+         * @param t_command The draw.
+         *
+         * @return True if the draw overlaps the batch; otherwise false.
+         */
+        [[nodiscard]] bool Overlaps(const Batch& t_batch, const DrawCommand& t_command) const;
+    };
+}
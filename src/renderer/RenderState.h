@@ -0,0 +1,110 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+//-------------------------------------------------
+// Forward declarations
+//-------------------------------------------------
+
+namespace mdcii::world::tile
+{
+    /**
+     * @brief Forward declaration struct TerrainTile.
+     */
+    struct TerrainTile;
+
+    /**
+     * @brief Forward declaration struct FigureTile.
+     */
+    struct FigureTile;
+}
+
+namespace mdcii::renderer
+{
+    //-------------------------------------------------
+    // AnimatedDraw
+    //-------------------------------------------------
+
+    /**
+     * @brief A retained draw whose source region changes with the frame of its tile.
+     */
+    struct AnimatedDraw
+    {
+        /**
+         * @brief The index of the draw in the DrawList.
+         */
+        int drawIndex{ -1 };
+
+        /**
+         * @brief The world position of the tile.
+         */
+        int x{ 0 };
+        int y{ 0 };
+
+        /**
+         * @brief The frame of the tile when the draw was last set.
+         */
+        int frame{ 0 };
+
+        /**
+         * @brief The animated tile; exactly one of them is set.
+         */
+        const world::tile::TerrainTile* terrainTile{ nullptr };
+        const world::tile::FigureTile* figureTile{ nullptr };
+    };
+
+    //-------------------------------------------------
+    // RenderState
+    //-------------------------------------------------
+
+    /**
+     * @brief The render data of a World that is kept between the frames.
+     */
+    struct RenderState
+    {
+        /**
+         * @brief The animated draws of the DrawList of the World, first the deep water, then the islands.
+         */
+        std::vector<AnimatedDraw> animatedDraws;
+
+        /**
+         * @brief The number of animated deep water draws at the front of `animatedDraws`.
+         */
+        int nrOfDeepWaterAnimatedDraws{ 0 };
+
+        /**
+         * @brief The index of the first draw of each visible island in the DrawList of the World,
+         *        followed by the index after the last draw of the islands.
+         */
+        std::vector<int> islandFirstDraws;
+
+        /**
+         * @brief The animated draws recorded for each visible island, relative to the DrawList of the island.
+         */
+        std::vector<std::vector<AnimatedDraw>> islandAnimatedDraws;
+
+        /**
+         * @brief For each visible island, whether the static tiles come from the imposter image.
+         */
+        std::vector<uint8_t> useImposters;
+    };
+}
@@ -16,8 +16,13 @@
 // along with this program; if not, write to the Free Software
 // Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
 
+#include <numeric>
 #include "Renderer.h"
-#include "MdciiRandom.h"
+#include "Profiler.h"
+#include "DrawList.h"
+#include "Game.h"
+#include "job/JobSystem.h"
+#include "state/State.h"
 #include "world/Island.h"
 #include "world/DeepWater.h"
 #include "world/layer/Layer.h"
@@ -31,6 +36,7 @@
 //-------------------------------------------------
 
 void mdcii::renderer::Renderer::RenderAsset(
+    DrawList* t_drawList,
     const resource::Asset t_asset,
     const int t_startX,
     const int t_startY,
@@ -46,18 +52,36 @@ void mdcii::renderer::Renderer::RenderAsset(
         screenPosition.y -= world::ELEVATIONS[magic_enum::enum_integer(t_world->camera->zoom)];
     }
 
-    t_world->state->game->DrawDecal(
+    t_drawList->Add(
         screenPosition,
         t_world->state->game->assetManager->GetAsset(t_asset, t_world->camera->zoom)->Decal(),
-        { 1.0f, 1.0f },
         t_tint
     );
 }
 
-void mdcii::renderer::Renderer::RenderWorldParts(const world::World* t_world, const float t_elapsedTime)
+void mdcii::renderer::Renderer::Render(const world::World* t_world, const bool t_rebuild)
 {
-    // update animations
-    UpdateAnimations(t_elapsedTime);
+    MDCII_PROFILE_SCOPE("Renderer::Render");
+
+    if (!t_rebuild)
+    {
+        UpdateAnimatedDraws(t_world);
+        return;
+    }
+
+    t_world->renderState->animatedDraws.clear();
+    t_world->drawList->Clear();
+
+    t_world->HasRenderLayerOption(world::RenderLayer::RENDER_ALL) ?
+        RenderWorld(t_world) :     // should be used in the release
+        RenderWorldParts(t_world); // ability to switch layers on and off
+
+    t_world->drawList->Retain();
+}
+
+void mdcii::renderer::Renderer::RenderWorldParts(const world::World* t_world)
+{
+    MDCII_PROFILE_SCOPE("Renderer::RenderWorldParts");
 
     // render deep water
     if (t_world->HasRenderLayerOption(world::RenderLayer::RENDER_DEEP_WATER_LAYER))
@@ -66,125 +90,267 @@ void mdcii::renderer::Renderer::RenderWorldParts(const world::World* t_world, co
     }
 
     // render islands
-    for (auto const& island : t_world->currentIslands)
-    {
-        using enum world::layer::LayerType;
+    RenderIslands(t_world, false);
+}
 
-        if (t_world->HasRenderLayerOption(world::RenderLayer::RENDER_MIXED_LAYER))
-        {
-            RenderIsland(t_world, island, MIXED);
-        }
-        else
+void mdcii::renderer::Renderer::RenderWorld(const world::World* t_world)
+{
+    MDCII_PROFILE_SCOPE("Renderer::RenderWorld");
+
+    // render deep water
+    RenderDeepWater(t_world);
+
+    // render islands
+    RenderIslands(t_world, true);
+}
+
+//-------------------------------------------------
+// Helper
+//-------------------------------------------------
+
+void mdcii::renderer::Renderer::UpdateAnimatedDraws(const world::World* t_world)
+{
+    MDCII_PROFILE_SCOPE("Renderer::UpdateAnimatedDraws");
+
+    for (auto& draw : t_world->renderState->animatedDraws)
+    {
+        if (draw.terrainTile)
         {
-            if (t_world->HasRenderLayerOption(world::RenderLayer::RENDER_COAST_LAYER))
-            {
-                RenderIsland(t_world, island, COAST);
-            }
-            if (t_world->HasRenderLayerOption(world::RenderLayer::RENDER_TERRAIN_LAYER))
-            {
-                RenderIsland(t_world, island, TERRAIN);
-            }
-            if (t_world->HasRenderLayerOption(world::RenderLayer::RENDER_BUILDINGS_LAYER))
+            if (draw.terrainTile->frame != draw.frame)
             {
-                RenderIsland(t_world, island, BUILDINGS);
+                t_world->tileAtlas->UpdateTile(draw.drawIndex, draw.x, draw.y, draw.terrainTile);
+                draw.frame = draw.terrainTile->frame;
             }
         }
+        else if (draw.figureTile->frame != draw.frame)
+        {
+            t_world->animalsTileAtlas->UpdateTile(draw.drawIndex, draw.x, draw.y, draw.figureTile);
+            draw.frame = draw.figureTile->frame;
+        }
     }
 }
 
-void mdcii::renderer::Renderer::RenderWorld(const world::World* t_world, const float t_elapsedTime)
+void mdcii::renderer::Renderer::RenderIslands(const world::World* t_world, const bool t_renderAll)
 {
-    // update animations
-    UpdateAnimations(t_elapsedTime);
+    MDCII_PROFILE_SCOPE("Renderer::RenderIslands");
 
-    // render deep water
-    RenderDeepWater(t_world);
+    const auto& islands{ t_world->currentIslands };
+    const auto nrOfIslands{ static_cast<int>(islands.size()) };
+    auto& renderState{ *t_world->renderState };
 
-    // render islands
-    for (auto const& island : t_world->currentIslands)
+    renderState.nrOfDeepWaterAnimatedDraws = static_cast<int>(renderState.animatedDraws.size());
+    renderState.useImposters.assign(nrOfIslands, 0);
+    if (static_cast<int>(renderState.islandAnimatedDraws.size()) < nrOfIslands)
     {
-        for (auto& terrainTile : island->GetTerrainLayer(world::layer::LayerType::MIXED)->currentTiles)
-        {
-            // render terrain tile
-            RenderTerrainTile(t_world, island, &terrainTile);
+        renderState.islandAnimatedDraws.resize(nrOfIslands);
+    }
 
-            // render an existing figure on top of the terrain tile
-            RenderFigureOnTopOfTerrainTile(t_world, island, &terrainTile);
-        }
+    std::vector<int> allIslands(nrOfIslands);
+    std::iota(allIslands.begin(), allIslands.end(), 0);
+    RecordIslands(t_world, t_renderAll, allIslands);
+
+    // merge the draws in painter order
+    auto& islandFirstDraws{ renderState.islandFirstDraws };
+    islandFirstDraws.resize(nrOfIslands + 1);
+    for (auto i{ 0 }; i < nrOfIslands; ++i)
+    {
+        islandFirstDraws[i] = t_world->drawList->Append(*islands[i]->GetDrawList());
     }
-}
+    islandFirstDraws[nrOfIslands] = static_cast<int>(t_world->drawList->GetCommands().size());
 
-//-------------------------------------------------
-// Helper
-//-------------------------------------------------
+    MergeAnimatedDraws(t_world);
+}
 
-void mdcii::renderer::Renderer::RenderIsland(const world::World* t_world, world::Island* t_island, const world::layer::LayerType t_layerType)
+void mdcii::renderer::Renderer::RenderChangedIslands(const world::World* t_world, const std::vector<int>& t_islands)
 {
-    for (auto& terrainTile : t_island->GetTerrainLayer(t_layerType)->currentTiles)
+    MDCII_PROFILE_SCOPE("Renderer::RenderChangedIslands");
+
+    const auto& islands{ t_world->currentIslands };
+    auto& islandFirstDraws{ t_world->renderState->islandFirstDraws };
+
+    RecordIslands(t_world, t_world->HasRenderLayerOption(world::RenderLayer::RENDER_ALL), t_islands);
+
+    // replace the draws of each island; the draws of the following islands are moved
+    for (const auto i : t_islands)
     {
-        RenderTerrainTile(t_world, t_island, &terrainTile);
+        const auto* drawList{ islands[i]->GetDrawList() };
+        const auto first{ islandFirstDraws[i] };
+        const auto count{ islandFirstDraws[i + 1] - first };
+        const auto shift{ static_cast<int>(drawList->GetCommands().size()) - count };
 
-        if (t_world->HasRenderLayerOption(world::RenderLayer::RENDER_FIGURES_LAYER))
+        t_world->drawList->Replace(first, count, *drawList);
+        for (auto k{ i + 1 }; k < static_cast<int>(islandFirstDraws.size()); ++k)
         {
-            RenderFigureOnTopOfTerrainTile(t_world, t_island, &terrainTile);
+            islandFirstDraws[k] += shift;
         }
     }
+
+    MergeAnimatedDraws(t_world);
 }
 
-void mdcii::renderer::Renderer::UpdateAnimations(const float t_elapsedTime)
+void mdcii::renderer::Renderer::RecordIslands(const world::World* t_world, const bool t_renderAll, const std::vector<int>& t_islands)
 {
-    resource::TileAtlas::CalcAnimationFrame(t_elapsedTime);
-    resource::AnimalsTileAtlas::CalcAnimationFrame(t_elapsedTime);
+    const auto& islands{ t_world->currentIslands };
+    auto& renderState{ *t_world->renderState };
+
+    // an island is rendered tile by tile while its imposter image is created or updated
+    const auto useImposters{ t_renderAll && t_world->UseIslandImposters() };
+    for (const auto i : t_islands)
+    {
+        renderState.useImposters[i] = useImposters && islands[i]->GetImposter()->IsReady();
+    }
+
+    // each island records its draws in its own DrawList
+    t_world->state->game->jobSystem->ParallelFor(static_cast<int>(t_islands.size()), [&](const int t_index)
+    {
+        const auto i{ t_islands[t_index] };
+        auto* island{ islands[i] };
+        auto& animatedDraws{ renderState.islandAnimatedDraws[i] };
+
+        island->GetDrawList()->Clear();
+        animatedDraws.clear();
+
+        t_renderAll ?
+            RenderIsland(t_world, island, renderState.useImposters[i] != 0, animatedDraws) :
+            RenderIslandLayers(t_world, island, animatedDraws);
+    });
 }
 
-void mdcii::renderer::Renderer::RenderDeepWater(const world::World* t_world)
+void mdcii::renderer::Renderer::MergeAnimatedDraws(const world::World* t_world)
 {
-    for (auto& waterTile : t_world->deepWater->layer->currentTiles)
+    auto& renderState{ *t_world->renderState };
+
+    renderState.animatedDraws.resize(renderState.nrOfDeepWaterAnimatedDraws);
+    for (auto i{ 0 }; i < static_cast<int>(t_world->currentIslands.size()); ++i)
     {
-        waterTile.UpdateFrame(resource::TileAtlas::frame_values);
-        t_world->tileAtlas->RenderTile(0, 0, &waterTile, olc::WHITE);
-        if (t_world->renderDeepWaterGrid)
+        for (auto animatedDraw : renderState.islandAnimatedDraws[i])
         {
-            RenderAsset(resource::Asset::BLUE_ISO, 0, 0, t_world, &waterTile, false);
+            animatedDraw.drawIndex += renderState.islandFirstDraws[i];
+            renderState.animatedDraws.push_back(animatedDraw);
         }
     }
 }
 
-void mdcii::renderer::Renderer::RenderFigureOnTopOfTerrainTile(
+void mdcii::renderer::Renderer::RenderIsland(
     const world::World* t_world,
     world::Island* t_island,
-    const world::tile::TerrainTile* t_terrainTile
+    const bool t_useImposter,
+    std::vector<AnimatedDraw>& t_animatedDraws
 )
 {
-    // todo TEMP Code
+    // the static tiles come from a cached image, only animated tiles and figures are rendered on top;
+    // the static tiles in front of them are partly drawn again to keep the painter order
+    if (t_useImposter)
+    {
+        const auto* imposter{ t_island->GetImposter() };
+        imposter->Render(t_island->GetDrawList());
+
+        t_island->GetMixedLayer()->ForEachCurrentTile([&](world::tile::TerrainTile& t_terrainTile)
+        {
+            if (t_terrainTile.IsAnimated())
+            {
+                RenderTerrainTile(t_world, t_island, &t_terrainTile, t_animatedDraws);
+            }
+            else
+            {
+                imposter->RenderOverlays(t_terrainTile, t_island->GetDrawList());
+            }
 
-    auto const& terrainTile{ t_island->GetTerrainLayer(world::layer::LayerType::TERRAIN)->GetSortedTile(t_terrainTile->posX, t_terrainTile->posY, t_world->camera->rotation) };
-    auto const& buildingsTile{ t_island->GetTerrainLayer(world::layer::LayerType::BUILDINGS)->GetSortedTile(t_terrainTile->posX, t_terrainTile->posY, t_world->camera->rotation) };
-    auto& figureTile{ t_island->GetFiguresLayer()->GetSortedTile(t_terrainTile->posX, t_terrainTile->posY, t_world->camera->rotation) };
+            RenderFigureOnTopOfTerrainTile(t_world, t_island, &t_terrainTile, t_animatedDraws);
+        });
+
+        return;
+    }
+
+    t_island->GetMixedLayer()->ForEachCurrentTile([&](world::tile::TerrainTile& t_terrainTile)
+    {
+        // render terrain tile
+        RenderTerrainTile(t_world, t_island, &t_terrainTile, t_animatedDraws);
+
+        // render an existing figure on top of the terrain tile
+        RenderFigureOnTopOfTerrainTile(t_world, t_island, &t_terrainTile, t_animatedDraws);
+    });
+}
+
+void mdcii::renderer::Renderer::RenderIslandLayers(const world::World* t_world, world::Island* t_island, std::vector<AnimatedDraw>& t_animatedDraws)
+{
+    using enum world::layer::LayerType;
 
-    if (figureTile.HasFigure())
+    if (t_world->HasRenderLayerOption(world::RenderLayer::RENDER_MIXED_LAYER))
     {
-        RenderFigureTile(t_world, t_island, &figureTile);
+        RenderIslandLayer(t_world, t_island, MIXED, t_animatedDraws);
     }
-    else if (t_island->GetFiguresLayer()->CountFigures(resource::FigureId::DEER_ID) < 3)
+    else
     {
-        if (terrainTile.HasBuildingAboveWaterAndCoast() && !buildingsTile.HasBuilding())
+        if (t_world->HasRenderLayerOption(world::RenderLayer::RENDER_COAST_LAYER))
         {
-            if (mdcii_uniform_random_int<int>(1, 1000) == 1000)
-            {
-                MDCII_LOG_DEBUG("[Renderer::RenderFigureOnTopOfTerrainTile()] Create new deer at ({}, {}).", t_terrainTile->posX, t_terrainTile->posX);
+            RenderIslandLayer(t_world, t_island, COAST, t_animatedDraws);
+        }
+        if (t_world->HasRenderLayerOption(world::RenderLayer::RENDER_TERRAIN_LAYER))
+        {
+            RenderIslandLayer(t_world, t_island, TERRAIN, t_animatedDraws);
+        }
+        if (t_world->HasRenderLayerOption(world::RenderLayer::RENDER_BUILDINGS_LAYER))
+        {
+            RenderIslandLayer(t_world, t_island, BUILDINGS, t_animatedDraws);
+        }
+    }
+}
 
-                auto& figure{ t_world->state->game->originalResourcesManager->GetFigureById(resource::FigureId::DEER_ID) };
-                figureTile.figure = &figure;
-                figureTile.rotation = mdcii_uniform_random_int<int>(1, 4);
-                figureTile.currentAnimation = 1;
+void mdcii::renderer::Renderer::RenderIslandLayer(
+    const world::World* t_world,
+    world::Island* t_island,
+    const world::layer::LayerType t_layerType,
+    std::vector<AnimatedDraw>& t_animatedDraws
+)
+{
+    const auto renderTile{ [&](world::tile::TerrainTile& t_terrainTile)
+    {
+        RenderTerrainTile(t_world, t_island, &t_terrainTile, t_animatedDraws);
 
-                // todo: write back to sortedTiles and tiles
+        if (t_world->HasRenderLayerOption(world::RenderLayer::RENDER_FIGURES_LAYER))
+        {
+            RenderFigureOnTopOfTerrainTile(t_world, t_island, &t_terrainTile, t_animatedDraws);
+        }
+    } };
 
-                // for count
-                t_island->GetFiguresLayer()->tiles.at(t_island->GetFiguresLayer()->GetSortedIndex(t_terrainTile->posX, t_terrainTile->posY, world::Rotation::DEG0)) = figureTile;
-            }
+    if (t_layerType == world::layer::LayerType::MIXED)
+    {
+        t_island->GetMixedLayer()->ForEachCurrentTile(renderTile);
+    }
+    else
+    {
+        t_island->GetTerrainLayer(t_layerType)->ForEachCurrentTile(renderTile);
+    }
+}
+
+void mdcii::renderer::Renderer::RenderDeepWater(const world::World* t_world)
+{
+    auto* drawList{ t_world->drawList.get() };
+
+    t_world->deepWater->ForEachCurrentTile([&](world::tile::TerrainTile& t_waterTile)
+    {
+        if (const auto drawIndex{ t_world->tileAtlas->RenderTile(drawList, 0, 0, &t_waterTile, olc::WHITE) }; drawIndex >= 0 && t_waterTile.IsAnimated())
+        {
+            t_world->renderState->animatedDraws.push_back({ drawIndex, t_waterTile.posX, t_waterTile.posY, t_waterTile.frame, &t_waterTile, nullptr });
+        }
+        if (t_world->renderDeepWaterGrid)
+        {
+            RenderAsset(drawList, resource::Asset::BLUE_ISO, 0, 0, t_world, &t_waterTile, false);
         }
+    });
+}
+
+void mdcii::renderer::Renderer::RenderFigureOnTopOfTerrainTile(
+    const world::World* t_world,
+    world::Island* t_island,
+    const world::tile::TerrainTile* t_terrainTile,
+    std::vector<AnimatedDraw>& t_animatedDraws
+)
+{
+    if (auto& figureTile{ t_island->GetFiguresLayer()->GetTile(t_terrainTile->posX, t_terrainTile->posY) }; figureTile.HasFigure())
+    {
+        RenderFigureTile(t_world, t_island, &figureTile, t_animatedDraws);
     }
 }
 
@@ -192,16 +358,20 @@ void mdcii::renderer::Renderer::RenderTerrainTile(
     const world::World* t_world,
     const world::Island* t_island,
     world::tile::TerrainTile* t_terrainTile,
-    const olc::Pixel& t_tint
+    std::vector<AnimatedDraw>& t_animatedDraws
 )
 {
     if (t_terrainTile->HasBuilding())
     {
-        t_terrainTile->UpdateFrame(resource::TileAtlas::frame_values);
-        t_world->tileAtlas->RenderTile(t_island->startX, t_island->startY, t_terrainTile, t_tint);
+        auto* drawList{ t_island->GetDrawList() };
+
+        if (const auto drawIndex{ t_world->tileAtlas->RenderTile(drawList, t_island->startX, t_island->startY, t_terrainTile, olc::WHITE) }; drawIndex >= 0 && t_terrainTile->IsAnimated())
+        {
+            t_animatedDraws.push_back({ drawIndex, t_island->startX + t_terrainTile->posX, t_island->startY + t_terrainTile->posY, t_terrainTile->frame, t_terrainTile, nullptr });
+        }
         if (t_world->renderIslandsGrid)
         {
-            RenderAsset(resource::Asset::GREEN_ISO, t_island->startX, t_island->startY, t_world, t_terrainTile, true);
+            RenderAsset(drawList, resource::Asset::GREEN_ISO, t_island->startX, t_island->startY, t_world, t_terrainTile, true);
         }
     }
 }
@@ -209,12 +379,15 @@ void mdcii::renderer::Renderer::RenderTerrainTile(
 void mdcii::renderer::Renderer::RenderFigureTile(
     const world::World* t_world,
     const world::Island* t_island,
-    world::tile::FigureTile* t_figureTile
+    world::tile::FigureTile* t_figureTile,
+    std::vector<AnimatedDraw>& t_animatedDraws
 )
 {
     if (t_figureTile->HasFigure())
     {
-        t_figureTile->UpdateFrame(resource::AnimalsTileAtlas::frame_values);
-        t_world->animalsTileAtlas->RenderTile(t_island->startX, t_island->startY, t_figureTile, olc::WHITE);
+        if (const auto drawIndex{ t_world->animalsTileAtlas->RenderTile(t_island->GetDrawList(), t_island->startX, t_island->startY, t_figureTile, olc::WHITE) }; drawIndex >= 0)
+        {
+            t_animatedDraws.push_back({ drawIndex, t_island->startX + t_figureTile->posX, t_island->startY + t_figureTile->posY, t_figureTile->frame, nullptr, t_figureTile });
+        }
     }
 }
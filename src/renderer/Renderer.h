@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <vector>
+#include "RenderState.h"
 #include "vendor/olc/olcPixelGameEngine.h"
 
 //-------------------------------------------------
@@ -73,6 +75,15 @@ namespace mdcii::resource
 
 namespace mdcii::renderer
 {
+    //-------------------------------------------------
+    // Forward declarations
+    //-------------------------------------------------
+
+    /**
+     * @brief Forward declaration class DrawList.
+     */
+    class DrawList;
+
     //-------------------------------------------------
     // Renderer
     //-------------------------------------------------
@@ -90,6 +101,7 @@ namespace mdcii::renderer
         /**
          * @brief Renders a specific asset on the screen.
          *
+         * @param t_drawList The DrawList to add to.
          * @param t_asset The asset to render.
          * @param t_startX The x offset.
          * @param t_startY The y offset.
@@ -99,6 +111,7 @@ namespace mdcii::renderer
          * @param t_tint Color tint for the asset (default is white).
          */
         static void RenderAsset(
+            DrawList* t_drawList,
             resource::Asset t_asset,
             int t_startX,
             int t_startY,
@@ -108,21 +121,38 @@ namespace mdcii::renderer
             const olc::Pixel& t_tint = olc::WHITE
         );
 
+        /**
+         * @brief Renders the world using the retained draws of the DrawList.
+         *
+         * The draws are only created again when required. Otherwise, only the animated draws
+         * are set to the current frame.
+         *
+         * @param t_world Pointer to the World object.
+         * @param t_rebuild True if the visible tiles, a layer or a render option has changed.
+         */
+        static void Render(const world::World* t_world, bool t_rebuild);
+
+        /**
+         * @brief Records the draws of some visible islands again and replaces their retained draws.
+         *
+         * @param t_world Pointer to the World object.
+         * @param t_islands The indices of the islands in the visible islands of the World.
+         */
+        static void RenderChangedIslands(const world::World* t_world, const std::vector<int>& t_islands);
+
         /**
          * @brief Renders various parts of the world, such as deep water and islands.
          *
          * @param t_world Pointer to the World object.
-         * @param t_elapsedTime The elapsed time for animations.
          */
-        static void RenderWorldParts(const world::World* t_world, float t_elapsedTime);
+        static void RenderWorldParts(const world::World* t_world);
 
         /**
          * @brief Renders the entire world, including deep water, islands and figures.
          *
          * @param t_world Pointer to the World object.
-         * @param t_elapsedTime The elapsed time for animations.
          */
-        static void RenderWorld(const world::World* t_world, float t_elapsedTime);
+        static void RenderWorld(const world::World* t_world);
 
     protected:
 
@@ -132,18 +162,68 @@ namespace mdcii::renderer
         //-------------------------------------------------
 
         /**
-         * @brief Renders an island based on the specified layer type.
+         * @brief Sets the animated draws to the current frame of their tiles.
+         *
+         * @param t_world Pointer to the World object.
+         */
+        static void UpdateAnimatedDraws(const world::World* t_world);
+
+        /**
+         * @brief Records the draws of all visible islands in parallel and merges them in painter order.
+         *
+         * @param t_world Pointer to the World object.
+         * @param t_renderAll True if all layers are rendered; otherwise the render layer options are used.
+         */
+        static void RenderIslands(const world::World* t_world, bool t_renderAll);
+
+        /**
+         * @brief Records the draws of some visible islands in parallel, each in its own DrawList.
+         *
+         * @param t_world Pointer to the World object.
+         * @param t_renderAll True if all layers are rendered; otherwise the render layer options are used.
+         * @param t_islands The indices of the islands in the visible islands of the World.
+         */
+        static void RecordIslands(const world::World* t_world, bool t_renderAll, const std::vector<int>& t_islands);
+
+        /**
+         * @brief Appends the animated draws of the visible islands to the animated deep water draws.
+         *
+         * @param t_world Pointer to the World object.
+         */
+        static void MergeAnimatedDraws(const world::World* t_world);
+
+        /**
+         * @brief Records the draws of all layers of an island.
+         *
+         * @param t_world Pointer to the World object.
+         * @param t_island Pointer to the Island object to be rendered.
+         * @param t_useImposter True if the static tiles come from the imposter image.
+         * @param t_animatedDraws Receives the animated draws.
+         */
+        static void RenderIsland(const world::World* t_world, world::Island* t_island, bool t_useImposter, std::vector<AnimatedDraw>& t_animatedDraws);
+
+        /**
+         * @brief Records the draws of the layers of an island selected by the render layer options.
+         *
+         * @param t_world Pointer to the World object.
+         * @param t_island Pointer to the Island object to be rendered.
+         * @param t_animatedDraws Receives the animated draws.
+         */
+        static void RenderIslandLayers(const world::World* t_world, world::Island* t_island, std::vector<AnimatedDraw>& t_animatedDraws);
+
+        /**
+         * @brief Records the draws of an island based on the specified layer type.
          *
          * @param t_world Pointer to the World object.
          * @param t_island Pointer to the Island object to be rendered.
          * @param t_layerType The type of layer to render.
+         * @param t_animatedDraws Receives the animated draws.
          */
-        static void RenderIsland(const world::World* t_world, world::Island* t_island, world::layer::LayerType t_layerType);
+        static void RenderIslandLayer(const world::World* t_world, world::Island* t_island, world::layer::LayerType t_layerType, std::vector<AnimatedDraw>& t_animatedDraws);
 
-        static void UpdateAnimations(float t_elapsedTime);
         static void RenderDeepWater(const world::World* t_world);
-        static void RenderFigureOnTopOfTerrainTile(const world::World* t_world, world::Island* t_island, const world::tile::TerrainTile* t_terrainTile);
-        static void RenderTerrainTile(const world::World* t_world, const world::Island* t_island, world::tile::TerrainTile* t_terrainTile, const olc::Pixel& t_tint = olc::WHITE);
-        static void RenderFigureTile(const world::World* t_world, const world::Island* t_island, world::tile::FigureTile* t_figureTile);
+        static void RenderFigureOnTopOfTerrainTile(const world::World* t_world, world::Island* t_island, const world::tile::TerrainTile* t_terrainTile, std::vector<AnimatedDraw>& t_animatedDraws);
+        static void RenderTerrainTile(const world::World* t_world, const world::Island* t_island, world::tile::TerrainTile* t_terrainTile, std::vector<AnimatedDraw>& t_animatedDraws);
+        static void RenderFigureTile(const world::World* t_world, const world::Island* t_island, world::tile::FigureTile* t_figureTile, std::vector<AnimatedDraw>& t_animatedDraws);
     };
 }
@@ -16,9 +16,11 @@
 // along with this program; if not, write to the Free Software
 // Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
 
+#include <algorithm>
 #include "AnimalsTileAtlas.h"
 #include "world/layer/Layer.h"
 #include "camera/Camera.h"
+#include "renderer/DrawList.h"
 
 //-------------------------------------------------
 // Ctors. / Dtor.
@@ -42,7 +44,8 @@ mdcii::resource::AnimalsTileAtlas::~AnimalsTileAtlas() noexcept
 // Logic
 //-------------------------------------------------
 
-void mdcii::resource::AnimalsTileAtlas::RenderTile(
+int mdcii::resource::AnimalsTileAtlas::RenderTile(
+    renderer::DrawList* t_drawList,
     const int t_startX,
     const int t_startY,
     const world::tile::FigureTile* t_tile,
@@ -50,102 +53,43 @@ void mdcii::resource::AnimalsTileAtlas::RenderTile(
 ) const
 {
     const auto zoomInt{ magic_enum::enum_integer(m_world->camera->zoom) };
+    const auto [screenPosition, decal, sourcePos]{ CalcTileDraw(t_tile->posX + t_startX, t_tile->posY + t_startY, t_tile) };
 
-    const auto animationOffset{ t_tile->figure->animations[t_tile->currentAnimation].animOffs };
-    const auto gfx{
-        t_tile->figure->gfx + animationOffset + (t_tile->rotation * t_tile->figure->animations[t_tile->currentAnimation].animAnz) + t_tile->frame
-    };
-
-    const olc::vf2d atlasOffset{ GetAtlasOffset(gfx, NR_OF_ROWS) };
-
-    olc::vf2d screenPosition{ m_world->ToScreen(t_tile->posX + t_startX, t_tile->posY + t_startY) };
-    screenPosition.y -= CalcOffset(gfx);
-
-    m_world->state->game->DrawPartialDecal(
+    return t_drawList->Add(
         screenPosition,
-        m_atlas[zoomInt][GetAtlasIndex(gfx, NR_OF_ROWS)]->Decal(),
-        {
-            atlasOffset.x * LARGEST_SIZE[zoomInt].second.first,
-            atlasOffset.y * LARGEST_SIZE[zoomInt].second.second
-        },
+        decal,
+        sourcePos,
         {
             LARGEST_SIZE[zoomInt].second.first,
             LARGEST_SIZE[zoomInt].second.second
         },
-        { 1.0f, 1.0f },
         t_tint
     );
 }
 
-void mdcii::resource::AnimalsTileAtlas::CalcAnimationFrame(const float t_elapsedTime)
+void mdcii::resource::AnimalsTileAtlas::UpdateTile(
+    const int t_drawIndex,
+    const int t_x,
+    const int t_y,
+    const world::tile::FigureTile* t_tile
+) const
 {
-    for (auto& timer : m_timer_values)
-    {
-        timer += t_elapsedTime;
-    }
-
-    if (m_timer_values[0] >= 0.075f)
-    {
-        frame_values[0] = ++frame_values[0];
-        m_timer_values[0] = 0.0f;
-        frame_values[0] %= MAX_FRAME_VALUE + 1;
-    }
-
-    if (m_timer_values[1] >= 0.11f)
-    {
-        frame_values[1] = ++frame_values[1];
-        m_timer_values[1] = 0.0f;
-        frame_values[1] %= MAX_FRAME_VALUE + 1;
-    }
-
-    if (m_timer_values[2] >= 0.13f)
-    {
-        frame_values[2] = ++frame_values[2];
-        m_timer_values[2] = 0.0f;
-        frame_values[2] %= MAX_FRAME_VALUE + 1;
-    }
-
-    if (m_timer_values[3] >= 0.135f)
-    {
-        frame_values[3] = ++frame_values[3];
-        m_timer_values[3] = 0.0f;
-        frame_values[3] %= MAX_FRAME_VALUE + 1;
-    }
-
-    if (m_timer_values[4] >= 0.195f)
-    {
-        frame_values[4] = ++frame_values[4];
-        m_timer_values[4] = 0.0f;
-        frame_values[4] %= MAX_FRAME_VALUE + 1;
-    }
-
-    if (m_timer_values[5] >= 0.3f)
-    {
-        frame_values[5] = ++frame_values[5];
-        m_timer_values[5] = 0.0f;
-        frame_values[5] %= MAX_FRAME_VALUE + 1;
-    }
+    const auto [screenPosition, decal, sourcePos]{ CalcTileDraw(t_x, t_y, t_tile) };
+    m_world->drawList->Update(t_drawIndex, screenPosition, decal, sourcePos);
+}
 
-    if (m_timer_values[6] >= 0.5f)
-    {
-        frame_values[6] = ++frame_values[6];
-        m_timer_values[6] = 0.0f;
-        frame_values[6] %= MAX_FRAME_VALUE + 1;
-    }
+std::pair<olc::vf2d, olc::vf2d> mdcii::resource::AnimalsTileAtlas::CalcCellScreenArea(const int t_x, const int t_y) const
+{
+    const auto zoom{ m_world->camera->zoom };
+    const auto zoomInt{ magic_enum::enum_integer(zoom) };
+    const auto tileHeight{ static_cast<float>(zoom == world::Zoom::GFX ? 31 : get_tile_height(zoom)) };
+    const auto height{ std::max(LARGEST_SIZE[zoomInt].second.second, tileHeight) };
 
-    if (m_timer_values[7] >= 0.75f)
-    {
-        frame_values[7] = ++frame_values[7];
-        m_timer_values[7] = 0.0f;
-        frame_values[7] %= MAX_FRAME_VALUE + 1;
-    }
+    // a figure is always raised by the elevation and its bottom is never below the bottom of the tile
+    olc::vf2d position{ m_world->ToScreen(t_x, t_y) };
+    position.y += tileHeight - world::ELEVATIONS[zoomInt] - height;
 
-    if (m_timer_values[8] >= 1.0f)
-    {
-        frame_values[8] = ++frame_values[8];
-        m_timer_values[8] = 0.0f;
-        frame_values[8] %= MAX_FRAME_VALUE + 1;
-    }
+    return { position, { LARGEST_SIZE[zoomInt].second.first, height } };
 }
 
 //-------------------------------------------------
@@ -172,3 +116,31 @@ float mdcii::resource::AnimalsTileAtlas::CalcOffset(const int t_gfx) const
 
     return offset;
 }
+
+std::tuple<olc::vf2d, olc::Decal*, olc::vf2d> mdcii::resource::AnimalsTileAtlas::CalcTileDraw(
+    const int t_x,
+    const int t_y,
+    const world::tile::FigureTile* t_tile
+) const
+{
+    const auto zoomInt{ magic_enum::enum_integer(m_world->camera->zoom) };
+
+    const auto animationOffset{ t_tile->figure->animations[t_tile->currentAnimation].animOffs };
+    const auto gfx{
+        t_tile->figure->gfx + animationOffset + (t_tile->rotation * t_tile->figure->animations[t_tile->currentAnimation].animAnz) + t_tile->frame
+    };
+
+    const olc::vf2d atlasOffset{ GetAtlasOffset(gfx, NR_OF_ROWS) };
+
+    olc::vf2d screenPosition{ m_world->ToScreen(t_x, t_y) };
+    screenPosition.y -= CalcOffset(gfx);
+
+    return {
+        screenPosition,
+        m_atlas[zoomInt][GetAtlasIndex(gfx, NR_OF_ROWS)]->Decal(),
+        {
+            atlasOffset.x * LARGEST_SIZE[zoomInt].second.first,
+            atlasOffset.y * LARGEST_SIZE[zoomInt].second.second
+        }
+    };
+}
@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <tuple>
 #include "BshTileAtlas.h"
 
 //-------------------------------------------------
@@ -40,6 +41,14 @@ namespace mdcii::world::tile
     struct FigureTile;
 }
 
+namespace mdcii::renderer
+{
+    /**
+     * @brief Forward declaration class DrawList.
+     */
+    class DrawList;
+}
+
 namespace mdcii::resource
 {
     //-------------------------------------------------
@@ -52,15 +61,6 @@ namespace mdcii::resource
     class AnimalsTileAtlas : public BshTileAtlas
     {
     public:
-        //-------------------------------------------------
-        // Member
-        //-------------------------------------------------
-
-        /**
-         * @brief When one of the timers expires, the respective frame is counted up.
-         */
-        inline static std::array frame_values{ 0, 0, 0, 0, 0, 0, 0, 0, 0 };
-
         //-------------------------------------------------
         // Ctors. / Dtor.
         //-------------------------------------------------
@@ -85,8 +85,38 @@ namespace mdcii::resource
         // Logic
         //-------------------------------------------------
 
-        void RenderTile(int t_startX, int t_startY, const world::tile::FigureTile* t_tile, const olc::Pixel& t_tint) const;
-        static void CalcAnimationFrame(float t_elapsedTime);
+        /**
+         * @brief Adds a figure to a DrawList.
+         *
+         * @param t_drawList The DrawList to add to.
+         * @param t_startX The x offset.
+         * @param t_startY The y offset.
+         * @param t_tile Pointer to the tile.
+         * @param t_tint Color tint.
+         *
+         * @return The index of the draw in the DrawList.
+         */
+        int RenderTile(renderer::DrawList* t_drawList, int t_startX, int t_startY, const world::tile::FigureTile* t_tile, const olc::Pixel& t_tint) const;
+
+        /**
+         * @brief Sets a retained draw of the DrawList to the current frame of a figure.
+         *
+         * @param t_drawIndex The index of the draw in the DrawList.
+         * @param t_x The x position of the tile in the world.
+         * @param t_y The y position of the tile in the world.
+         * @param t_tile Pointer to the tile.
+         */
+        void UpdateTile(int t_drawIndex, int t_x, int t_y, const world::tile::FigureTile* t_tile) const;
+
+        /**
+         * @brief Calculates the screen area that any frame of a figure on a world position can cover.
+         *
+         * @param t_x The world x position.
+         * @param t_y The world y position.
+         *
+         * @return The top left corner and the size.
+         */
+        [[nodiscard]] std::pair<olc::vf2d, olc::vf2d> CalcCellScreenArea(int t_x, int t_y) const;
 
     protected:
 
@@ -119,11 +149,6 @@ namespace mdcii::resource
          */
         static constexpr std::string_view TILE_ATLAS_NAME{ "animals" };
 
-        /**
-         * @brief To avoid m_frame_values[] will exceed that value.
-         */
-        static constexpr int MAX_FRAME_VALUE{ 1000 };
-
         //-------------------------------------------------
         // Member
         //-------------------------------------------------
@@ -133,18 +158,11 @@ namespace mdcii::resource
          */
         const world::World* m_world{ nullptr };
 
-        /**
-         * @brief Timers to measure the times for the next frame.
-         *
-         * The animation speeds of the animals are finally defined.
-         * So after 75, 110, 130, 135, 195, 300, 500, 750 and 1000 milliseconds the next frame from the animation is used.
-         */
-        inline static std::array m_timer_values{ 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
-
         //-------------------------------------------------
         // Helper
         //-------------------------------------------------
 
         [[nodiscard]] float CalcOffset(int t_gfx) const;
+        [[nodiscard]] std::tuple<olc::vf2d, olc::Decal*, olc::vf2d> CalcTileDraw(int t_x, int t_y, const world::tile::FigureTile* t_tile) const;
     };
 }
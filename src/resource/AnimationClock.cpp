@@ -0,0 +1,111 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#include <algorithm>
+#include "AnimationClock.h"
+#include "Buildings.h"
+#include "MdciiAssert.h"
+
+//-------------------------------------------------
+// Create
+//-------------------------------------------------
+
+void mdcii::resource::AnimationClock::Create(const Buildings& t_buildings, const Figures& t_figures)
+{
+    MDCII_LOG_DEBUG("[AnimationClock::Create()] Create the animation clocks.");
+
+    m_animTimes.clear();
+
+    for (const auto& [id, building] : t_buildings.buildingsMap)
+    {
+        if (building.animAnz > 1)
+        {
+            Register(building.animTime);
+        }
+    }
+
+    for (const auto& [id, figure] : t_figures.figuresMap)
+    {
+        for (const auto& animation : figure.animations)
+        {
+            if (animation.animAnz > 1)
+            {
+                Register(animation.animSpeed);
+            }
+        }
+    }
+
+    m_timerValues.assign(m_animTimes.size(), 0.0f);
+    m_frameValues.assign(m_animTimes.size(), 0);
+
+    MDCII_LOG_DEBUG("[AnimationClock::Create()] Registered {} animation clocks.", m_animTimes.size());
+}
+
+//-------------------------------------------------
+// Getter
+//-------------------------------------------------
+
+int mdcii::resource::AnimationClock::GetClock(const int t_animTime)
+{
+    if (t_animTime <= 0)
+    {
+        return NO_CLOCK;
+    }
+
+    if (const auto it{ std::ranges::lower_bound(m_animTimes, t_animTime) }; it != m_animTimes.end() && *it == t_animTime)
+    {
+        return static_cast<int>(std::distance(m_animTimes.begin(), it));
+    }
+
+    return NO_CLOCK;
+}
+
+//-------------------------------------------------
+// Logic
+//-------------------------------------------------
+
+void mdcii::resource::AnimationClock::Update(const float t_elapsedTime)
+{
+    for (auto i{ 0u }; i < m_animTimes.size(); ++i)
+    {
+        m_timerValues[i] += t_elapsedTime;
+
+        if (m_timerValues[i] >= static_cast<float>(m_animTimes[i]) / 1000.0f)
+        {
+            m_timerValues[i] = 0.0f;
+            m_frameValues[i] = (m_frameValues[i] + 1) % (MAX_FRAME_VALUE + 1);
+        }
+    }
+}
+
+//-------------------------------------------------
+// Helper
+//-------------------------------------------------
+
+void mdcii::resource::AnimationClock::Register(const int t_animTime)
+{
+    if (t_animTime <= 0)
+    {
+        return;
+    }
+
+    if (const auto it{ std::ranges::lower_bound(m_animTimes, t_animTime) }; it == m_animTimes.end() || *it != t_animTime)
+    {
+        m_animTimes.insert(it, t_animTime);
+    }
+}
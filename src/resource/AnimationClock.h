@@ -0,0 +1,146 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#pragma once
+
+#include <vector>
+
+namespace mdcii::resource
+{
+    //-------------------------------------------------
+    // Forward declarations
+    //-------------------------------------------------
+
+    /**
+     * @brief Forward declaration class Buildings.
+     */
+    class Buildings;
+
+    /**
+     * @brief Forward declaration class Figures.
+     */
+    class Figures;
+
+    //-------------------------------------------------
+    // AnimationClock
+    //-------------------------------------------------
+
+    /**
+     * @brief Counts up a frame value for each distinct animation time of the buildings and figures.
+     */
+    class AnimationClock
+    {
+    public:
+        //-------------------------------------------------
+        // Constants
+        //-------------------------------------------------
+
+        /**
+         * @brief Returned for animation times without a clock.
+         */
+        static constexpr auto NO_CLOCK{ -1 };
+
+        //-------------------------------------------------
+        // Create
+        //-------------------------------------------------
+
+        /**
+         * @brief Registers a clock for each distinct animation time.
+         *
+         * @param t_buildings The buildings from the haeuser.cod.
+         * @param t_figures The figures from the figuren.cod.
+         */
+        static void Create(const Buildings& t_buildings, const Figures& t_figures);
+
+        //-------------------------------------------------
+        // Getter
+        //-------------------------------------------------
+
+        /**
+         * @brief Returns the clock of an animation time.
+         *
+         * @param t_animTime The animation time in milliseconds.
+         *
+         * @return The index of the clock or `NO_CLOCK`.
+         */
+        [[nodiscard]] static int GetClock(int t_animTime);
+
+        /**
+         * @brief Returns the current frame of an animation.
+         *
+         * @param t_clock The index of the clock.
+         * @param t_animAnz The number of frames of the animation.
+         *
+         * @return The current frame.
+         */
+        [[nodiscard]] static int GetFrame(const int t_clock, const int t_animAnz) { return m_frameValues[t_clock] % t_animAnz; }
+
+        //-------------------------------------------------
+        // Logic
+        //-------------------------------------------------
+
+        /**
+         * @brief Counts up the frame value of each clock whose time has expired.
+         *
+         * @param t_elapsedTime The time since the last update.
+         */
+        static void Update(float t_elapsedTime);
+
+    protected:
+
+    private:
+        //-------------------------------------------------
+        // Constants
+        //-------------------------------------------------
+
+        /**
+         * @brief To avoid m_frameValues[] will exceed that value.
+         */
+        static constexpr int MAX_FRAME_VALUE{ 1000 };
+
+        //-------------------------------------------------
+        // Member
+        //-------------------------------------------------
+
+        /**
+         * @brief The sorted animation times in milliseconds.
+         */
+        inline static std::vector<int> m_animTimes;
+
+        /**
+         * @brief The time since the last frame of each clock.
+         */
+        inline static std::vector<float> m_timerValues;
+
+        /**
+         * @brief The frame value of each clock.
+         */
+        inline static std::vector<int> m_frameValues;
+
+        //-------------------------------------------------
+        // Helper
+        //-------------------------------------------------
+
+        /**
+         * @brief Registers a clock for an animation time if it does not already exist.
+         *
+         * @param t_animTime The animation time in milliseconds.
+         */
+        static void Register(int t_animTime);
+    };
+}
@@ -0,0 +1,192 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include "AssetCache.h"
+#include "MappedFile.h"
+#include "Game.h"
+#include "Log.h"
+#include "MdciiException.h"
+
+//-------------------------------------------------
+// Key
+//-------------------------------------------------
+
+uint64_t mdcii::resource::AssetCache::CreateKey(const std::initializer_list<std::span<const uint8_t>> t_sources)
+{
+    auto hash{ Hash({ reinterpret_cast<const uint8_t*>(&VERSION), sizeof(VERSION) }, FNV_OFFSET_BASIS) };
+    hash = Hash({ reinterpret_cast<const uint8_t*>(Game::VERSION.data()), Game::VERSION.size() }, hash);
+
+    for (const auto source : t_sources)
+    {
+        // the size separates the sources
+        const uint64_t size{ source.size() };
+        hash = Hash({ reinterpret_cast<const uint8_t*>(&size), sizeof(size) }, hash);
+        hash = Hash(source, hash);
+    }
+
+    return hash;
+}
+
+//-------------------------------------------------
+// Load / store
+//-------------------------------------------------
+
+std::unique_ptr<mdcii::resource::MappedFile> mdcii::resource::AssetCache::Load(const std::string& t_name, const uint64_t t_key)
+{
+    const auto entryPath{ GetEntryPath(t_name, t_key) };
+    if (!std::filesystem::exists(entryPath))
+    {
+        MDCII_LOG_INFO("[AssetCache::Load()] There is no cache entry {}.", entryPath);
+        return nullptr;
+    }
+
+    std::unique_ptr<MappedFile> entry;
+    try
+    {
+        entry = std::make_unique<MappedFile>(entryPath);
+    }
+    catch (const MdciiException& e)
+    {
+        MDCII_LOG_WARN("[AssetCache::Load()] The cache entry {} could not be mapped: {}", entryPath, e.what());
+        return nullptr;
+    }
+
+    const auto data{ entry->GetData() };
+
+    Header header;
+    if (data.size() < sizeof(Header))
+    {
+        MDCII_LOG_WARN("[AssetCache::Load()] The cache entry {} is invalid.", entryPath);
+        return nullptr;
+    }
+
+    std::memcpy(&header, data.data(), sizeof(Header));
+    if (header.magic != MAGIC || header.version != VERSION || header.key != t_key || header.payloadSize != data.size() - sizeof(Header))
+    {
+        MDCII_LOG_WARN("[AssetCache::Load()] The cache entry {} is invalid.", entryPath);
+        return nullptr;
+    }
+
+    MDCII_LOG_DEBUG("[AssetCache::Load()] The cache entry {} was mapped successfully.", entryPath);
+
+    return entry;
+}
+
+std::span<const uint8_t> mdcii::resource::AssetCache::GetPayload(const MappedFile& t_entry)
+{
+    return t_entry.GetData().subspan(sizeof(Header));
+}
+
+bool mdcii::resource::AssetCache::IsWritable()
+{
+    std::error_code errorCode;
+    std::filesystem::create_directories(GetCachePath(), errorCode);
+
+    const auto probePath{ GetCachePath() + ".probe.tmp" };
+    const auto writable{ std::ofstream{ probePath, std::ios::binary }.good() };
+    std::filesystem::remove(probePath, errorCode);
+
+    if (!writable)
+    {
+        MDCII_LOG_WARN("[AssetCache::IsWritable()] The cache folder {} is not writable.", GetCachePath());
+    }
+
+    return writable;
+}
+
+bool mdcii::resource::AssetCache::Store(const std::string& t_name, const uint64_t t_key, const std::span<const uint8_t> t_payload)
+{
+    const auto entryPath{ GetEntryPath(t_name, t_key) };
+    const auto tmpPath{ entryPath + ".tmp" };
+
+    std::error_code errorCode;
+    std::filesystem::create_directories(GetCachePath(), errorCode);
+
+    // a partly written entry never has the name of a valid entry
+    {
+        std::ofstream file{ tmpPath, std::ios::binary };
+
+        Header header;
+        header.key = t_key;
+        header.payloadSize = t_payload.size();
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+        file.write(reinterpret_cast<const char*>(t_payload.data()), static_cast<std::streamsize>(t_payload.size()));
+
+        if (!file)
+        {
+            MDCII_LOG_WARN("[AssetCache::Store()] The cache entry {} could not be written.", entryPath);
+            std::filesystem::remove(tmpPath, errorCode);
+
+            return false;
+        }
+    }
+
+    std::filesystem::rename(tmpPath, entryPath, errorCode);
+    if (errorCode)
+    {
+        MDCII_LOG_WARN("[AssetCache::Store()] The cache entry {} could not be written: {}", entryPath, errorCode.message());
+        std::filesystem::remove(tmpPath, errorCode);
+
+        return false;
+    }
+
+    // remove the entries of older sources
+    const auto prefix{ t_name + "-" };
+    const auto fileName{ std::filesystem::path(entryPath).filename().string() };
+    for (const auto& dirEntry : std::filesystem::directory_iterator(GetCachePath(), errorCode))
+    {
+        const auto name{ dirEntry.path().filename().string() };
+        if (name != fileName && name.starts_with(prefix) && dirEntry.path().extension() == ".bin")
+        {
+            std::filesystem::remove(dirEntry.path(), errorCode);
+        }
+    }
+
+    MDCII_LOG_INFO("[AssetCache::Store()] The cache entry {} was written successfully.", entryPath);
+
+    return true;
+}
+
+//-------------------------------------------------
+// Helper
+//-------------------------------------------------
+
+uint64_t mdcii::resource::AssetCache::Hash(const std::span<const uint8_t> t_data, uint64_t t_hash)
+{
+    for (const auto byte : t_data)
+    {
+        t_hash ^= byte;
+        t_hash *= FNV_PRIME;
+    }
+
+    return t_hash;
+}
+
+std::string mdcii::resource::AssetCache::GetCachePath()
+{
+    return Game::RESOURCES_REL_PATH + "cache/";
+}
+
+std::string mdcii::resource::AssetCache::GetEntryPath(const std::string& t_name, const uint64_t t_key)
+{
+    return fmt::format("{}{}-{:016x}.bin", GetCachePath(), t_name, t_key);
+}
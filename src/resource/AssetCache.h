@@ -0,0 +1,186 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#pragma once
+
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <span>
+#include <string>
+
+namespace mdcii::resource
+{
+    //-------------------------------------------------
+    // Forward declarations
+    //-------------------------------------------------
+
+    /**
+     * @brief Forward declaration class MappedFile.
+     */
+    class MappedFile;
+
+    //-------------------------------------------------
+    // AssetCache
+    //-------------------------------------------------
+
+    /**
+     * @brief Stores decoded assets in the cache folder of the resources.
+     *
+     * Each entry is a binary file that can be mapped into memory. It is identified by a name
+     * and a key created from the bytes of the sources the asset was made of. An entry with
+     * another key or another version is ignored and replaced on the next store.
+     */
+    class AssetCache
+    {
+    public:
+        //-------------------------------------------------
+        // Constants
+        //-------------------------------------------------
+
+        /**
+         * @brief Increment this value if the layout of an entry changes.
+         */
+        static constexpr uint32_t VERSION{ 1 };
+
+        //-------------------------------------------------
+        // Key
+        //-------------------------------------------------
+
+        /**
+         * @brief Creates a key from the cache version, the game version and the given bytes.
+         *
+         * @param t_sources The bytes of the sources of an asset.
+         *
+         * @return The key.
+         */
+        [[nodiscard]] static uint64_t CreateKey(std::initializer_list<std::span<const uint8_t>> t_sources);
+
+        //-------------------------------------------------
+        // Load / store
+        //-------------------------------------------------
+
+        /**
+         * @brief Maps an entry into memory.
+         *
+         * @param t_name The name of the entry.
+         * @param t_key The key of the sources.
+         *
+         * @return The mapped entry or nullptr if there is no valid entry with the given key.
+         */
+        [[nodiscard]] static std::unique_ptr<MappedFile> Load(const std::string& t_name, uint64_t t_key);
+
+        /**
+         * @brief Returns the stored bytes of a mapped entry.
+         *
+         * @param t_entry An entry returned by `Load()`.
+         *
+         * @return The stored bytes without the header.
+         */
+        [[nodiscard]] static std::span<const uint8_t> GetPayload(const MappedFile& t_entry);
+
+        /**
+         * @brief Checks whether entries can be written to the cache folder.
+         *
+         * Creates the cache folder if it doesn't exist.
+         *
+         * @return True if an entry can be written; otherwise false.
+         */
+        [[nodiscard]] static bool IsWritable();
+
+        /**
+         * @brief Writes an entry and removes the outdated entries with the same name.
+         *
+         * @param t_name The name of the entry.
+         * @param t_key The key of the sources.
+         * @param t_payload The bytes to store.
+         *
+         * @return True if successful; otherwise false.
+         */
+        static bool Store(const std::string& t_name, uint64_t t_key, std::span<const uint8_t> t_payload);
+
+    protected:
+
+    private:
+        //-------------------------------------------------
+        // Constants
+        //-------------------------------------------------
+
+        /**
+         * @brief Identifies a cache entry.
+         */
+        static constexpr uint64_t MAGIC{ 0x314341494943444d }; // "MDCIIAC1"
+
+        /**
+         * @brief The FNV-1a offset basis.
+         */
+        static constexpr uint64_t FNV_OFFSET_BASIS{ 14695981039346656037ull };
+
+        /**
+         * @brief The FNV-1a prime.
+         */
+        static constexpr uint64_t FNV_PRIME{ 1099511628211ull };
+
+        //-------------------------------------------------
+        // Header
+        //-------------------------------------------------
+
+        /**
+         * @brief The header of each entry. The size keeps the payload 8-byte aligned.
+         */
+        struct Header
+        {
+            uint64_t magic{ MAGIC };
+            uint32_t version{ VERSION };
+            uint32_t reserved{ 0 };
+            uint64_t key{ 0 };
+            uint64_t payloadSize{ 0 };
+        };
+
+        //-------------------------------------------------
+        // Helper
+        //-------------------------------------------------
+
+        /**
+         * @brief Hashes bytes with FNV-1a.
+         *
+         * @param t_data The bytes to hash.
+         * @param t_hash The hash value to continue with.
+         *
+         * @return The new hash value.
+         */
+        [[nodiscard]] static uint64_t Hash(std::span<const uint8_t> t_data, uint64_t t_hash);
+
+        /**
+         * @brief Returns the path of the cache folder.
+         *
+         * @return The path.
+         */
+        [[nodiscard]] static std::string GetCachePath();
+
+        /**
+         * @brief Returns the file path of an entry.
+         *
+         * @param t_name The name of the entry.
+         * @param t_key The key of the sources.
+         *
+         * @return The file path.
+         */
+        [[nodiscard]] static std::string GetEntryPath(const std::string& t_name, uint64_t t_key);
+    };
+}
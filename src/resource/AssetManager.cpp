@@ -17,6 +17,7 @@
 // Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
 
 #include "AssetManager.h"
+#include "Profiler.h"
 #include "MdciiAssert.h"
 #include "MdciiUtils.h"
 #include "MdciiException.h"
@@ -54,6 +55,8 @@ const olc::Renderable* mdcii::resource::AssetManager::GetAsset(const Asset t_ass
 
 void mdcii::resource::AssetManager::Init()
 {
+    MDCII_PROFILE_SCOPE("AssetManager::Init");
+
     MDCII_LOG_DEBUG("[AssetManager::Init()] Start load assets from {}textures ...", Game::RESOURCES_REL_PATH);
 
     for (const auto asset : magic_enum::enum_values<Asset>())
@@ -16,11 +16,10 @@
 // along with this program; if not, write to the Free Software
 // Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
 
-#include <fstream>
 #include "BinaryFile.h"
+#include "MappedFile.h"
+#include "Profiler.h"
 #include "Log.h"
-#include "MdciiException.h"
-#include "chunk/Chunk.h"
 
 //-------------------------------------------------
 // Ctors. / Dtor.
@@ -45,22 +44,21 @@ mdcii::resource::BinaryFile::~BinaryFile() noexcept
 
 void mdcii::resource::BinaryFile::ReadChunksFromFile()
 {
+    MDCII_PROFILE_SCOPE("BinaryFile::ReadChunksFromFile");
+
     MDCII_LOG_DEBUG("[BinaryFile::ReadChunksFromFile()] Reading Chunks from {}.", filePath);
 
-    std::ifstream input(filePath, std::ios::binary);
+    m_mappedFile = std::make_unique<MappedFile>(filePath);
 
-    if (!input.is_open())
-    {
-        throw MDCII_EXCEPTION("[BinaryFile::ReadChunksFromFile()] Error while opening file " + filePath + ".");
-    }
+    const auto bytes{ m_mappedFile->GetData() };
+    std::size_t offset{ 0 };
 
-    while (input.peek() != EOF)
+    while (offset < bytes.size())
     {
-        chunks.emplace_back(std::make_unique<chunk::Chunk>(input));
+        const auto& chunk{ chunks.emplace_back(bytes.subspan(offset)) };
+        offset += chunk::Chunk::HEADER_SIZE_IN_BYTES + chunk.length;
     }
 
-    input.close();
-
     if (chunks.empty())
     {
         MDCII_LOG_WARN("[BinaryFile::ReadChunksFromFile()] No Chunks were found.");
@@ -70,3 +68,11 @@ void mdcii::resource::BinaryFile::ReadChunksFromFile()
         MDCII_LOG_DEBUG("[BinaryFile::ReadChunksFromFile()] {} Chunk(s) were successfully read.", chunks.size());
     }
 }
+
+void mdcii::resource::BinaryFile::CloseFile()
+{
+    MDCII_LOG_DEBUG("[BinaryFile::CloseFile()] Close file {}.", filePath);
+
+    chunks.clear();
+    m_mappedFile.reset();
+}
@@ -21,21 +21,19 @@
 #include <memory>
 #include <string>
 #include <vector>
+#include "chunk/Chunk.h"
 
-//-------------------------------------------------
-// Forward declarations
-//-------------------------------------------------
-
-namespace mdcii::chunk
+namespace mdcii::resource
 {
+    //-------------------------------------------------
+    // Forward declarations
+    //-------------------------------------------------
+
     /**
-     * @brief Forward declaration class Chunk.
+     * @brief Forward declaration class MappedFile.
      */
-    class Chunk;
-}
+    class MappedFile;
 
-namespace mdcii::resource
-{
     //-------------------------------------------------
     // BinaryFile
     //-------------------------------------------------
@@ -57,8 +55,10 @@ namespace mdcii::resource
 
         /**
          * @brief Each file has one or many Chunk objects.
+         *
+         * The Chunks are views into the mapped file and are valid until `CloseFile()`.
          */
-        std::vector<std::unique_ptr<chunk::Chunk>> chunks;
+        std::vector<chunk::Chunk> chunks;
 
         //-------------------------------------------------
         // Ctors. / Dtor.
@@ -85,12 +85,20 @@ namespace mdcii::resource
         //-------------------------------------------------
 
         /**
-         * @brief Opens and reads the file.
+         * @brief Maps the file into memory.
          *
          * Chunk objects are created from the file content.
+         * All Chunk headers are validated before any data is read.
          */
         void ReadChunksFromFile();
 
+        /**
+         * @brief Removes the Chunk objects and unmaps the file.
+         *
+         * Should be called when the data of the Chunks is no longer needed.
+         */
+        void CloseFile();
+
         //-------------------------------------------------
         // Override
         //-------------------------------------------------
@@ -103,5 +111,13 @@ namespace mdcii::resource
     protected:
 
     private:
+        //-------------------------------------------------
+        // Member
+        //-------------------------------------------------
+
+        /**
+         * @brief The mapped file content the Chunks refer to.
+         */
+        std::unique_ptr<MappedFile> m_mappedFile;
     };
 }
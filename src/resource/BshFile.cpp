@@ -16,22 +16,34 @@
 // along with this program; if not, write to the Free Software
 // Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
 
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
 #include "BshFile.h"
+#include "AssetCache.h"
+#include "MappedFile.h"
+#include "Profiler.h"
 #include "Log.h"
 #include "MdciiException.h"
-#include "chunk/Chunk.h"
+#include "MdciiAssert.h"
+#include "MdciiUtils.h"
+#include "job/JobSystem.h"
 
 //-------------------------------------------------
 // Ctors. / Dtor.
 //-------------------------------------------------
 
-mdcii::resource::BshFile::BshFile(std::string t_filePath, std::vector<olc::Pixel> t_palette)
+mdcii::resource::BshFile::BshFile(std::string t_filePath, std::vector<olc::Pixel> t_palette, job::JobSystem* t_jobSystem, const std::size_t t_budget)
     : BinaryFile(std::move(t_filePath))
     , m_palette{ std::move(t_palette) }
+    , m_jobSystem{ t_jobSystem }
+    , m_budget{ t_budget }
 {
     MDCII_LOG_DEBUG("[BshFile::BshFile()] Create BshFile.");
 
-    if (chunks.at(0)->id.c_str() != CHUNK_ID) // NOLINT(*-redundant-string-cstr)
+    MDCII_ASSERT(m_budget > 0, "[BshFile::BshFile()] Invalid memory budget.")
+
+    if (chunks.at(0).id != CHUNK_ID)
     {
         throw MDCII_EXCEPTION("[BshFile::BshFile()] Invalid Chunk Id.");
     }
@@ -42,75 +54,183 @@ mdcii::resource::BshFile::~BshFile() noexcept
     MDCII_LOG_DEBUG("[BshFile::~BshFile()] Destruct BshFile.");
 }
 
+//-------------------------------------------------
+// Textures
+//-------------------------------------------------
+
+const mdcii::resource::BshTexture* mdcii::resource::BshFile::GetTexture(const int t_index)
+{
+    CheckIndex(t_index);
+
+    if (m_textures[t_index])
+    {
+        TouchTexture(t_index);
+    }
+    else
+    {
+        AddTexture(t_index, CreateTexture(t_index));
+    }
+
+    return m_textures[t_index].get();
+}
+
+void mdcii::resource::BshFile::Prefetch(const std::vector<int>& t_indices)
+{
+    MDCII_PROFILE_SCOPE("BshFile::Prefetch");
+
+    std::vector<int> missingIndices;
+    for (const auto index : t_indices)
+    {
+        CheckIndex(index);
+
+        if (m_textures[index])
+        {
+            TouchTexture(index);
+        }
+        else if (std::ranges::find(missingIndices, index) == missingIndices.end())
+        {
+            missingIndices.push_back(index);
+        }
+    }
+
+    if (missingIndices.empty())
+    {
+        return;
+    }
+
+    // each job writes its own slot
+    std::vector<std::unique_ptr<BshTexture>> textures(missingIndices.size());
+    ForEach(static_cast<int>(missingIndices.size()), [&](const int t_index) { textures[t_index] = CreateTexture(missingIndices[t_index]); });
+
+    // the decals are created on the calling thread
+    for (auto i{ 0u }; i < missingIndices.size(); ++i)
+    {
+        AddTexture(missingIndices[i], std::move(textures[i]));
+    }
+}
+
+void mdcii::resource::BshFile::ReleaseUnusedTextures()
+{
+    while (m_residentBytes > m_budget && !m_lru.empty())
+    {
+        const auto index{ m_lru.back() };
+        m_lru.pop_back();
+
+        m_residentBytes -= GetTextureBytes(*m_textures[index]);
+        m_textures[index].reset();
+    }
+}
+
 //-------------------------------------------------
 // Override
 //-------------------------------------------------
 
 void mdcii::resource::BshFile::ReadDataFromChunks()
 {
-    MDCII_LOG_DEBUG("[BshFile::ReadDataFromChunks()] Start reading BSH pixel data from Chunks...");
+    MDCII_PROFILE_SCOPE("BshFile::ReadDataFromChunks");
 
-    // get pointer to the first element
-    const auto* dataPtr{ reinterpret_cast<const uint32_t*>(chunks.at(0)->data.data()) };
+    MDCII_LOG_DEBUG("[BshFile::ReadDataFromChunks()] Start reading BSH offsets from Chunks...");
+
+    const auto data{ chunks.at(0).data };
+    if (data.size() < sizeof(uint32_t))
+    {
+        throw MDCII_EXCEPTION("[BshFile::ReadDataFromChunks()] Invalid Chunk length.");
+    }
 
     // read and store the first offset
-    const auto firstOffset{ *dataPtr };
+    const auto firstOffset{ ReadUint32(data, 0) };
     m_offsets.push_back(firstOffset);
 
     // calc number of textures
     const auto count{ firstOffset / 4u };
+    if (firstOffset > data.size())
+    {
+        throw MDCII_EXCEPTION("[BshFile::ReadDataFromChunks()] Invalid offset table.");
+    }
 
     // store other offsets
     for (auto i{ 1u }; i < count; ++i)
     {
-        m_offsets.push_back(dataPtr[i]);
+        m_offsets.push_back(ReadUint32(data, i * sizeof(uint32_t)));
     }
 
     MDCII_LOG_DEBUG("[BshFile::ReadDataFromChunks()] Detected {} offsets.", m_offsets.size());
 
-    // create BshTexture objects
-    for (const auto offset : m_offsets)
-    {
-        DecodePixelData(offset);
-    }
+    m_textures.resize(m_offsets.size());
+    m_lruPositions.resize(m_offsets.size());
 
-    // create renderables
-    CreateRenderables();
+    MDCII_LOG_DEBUG("[BshFile::ReadDataFromChunks()] BSH offsets read successfully.");
 
-    MDCII_LOG_DEBUG("[BshFile::ReadDataFromChunks()] BSH pixel data read successfully.");
+    LoadCache();
 }
 
 //-------------------------------------------------
 // Helper
 //-------------------------------------------------
 
-void mdcii::resource::BshFile::DecodePixelData(const uint32_t t_offset)
+std::unique_ptr<mdcii::resource::BshTexture> mdcii::resource::BshFile::CreateTexture(const int t_index) const
+{
+    auto bshTexture{ std::make_unique<BshTexture>() };
+
+    if (m_cache.empty())
+    {
+        std::tie(bshTexture->width, bshTexture->height) = ReadImageSize(m_offsets[t_index]);
+        bshTexture->sprite = std::make_unique<olc::Sprite>(bshTexture->width, bshTexture->height);
+
+        DecodePixelData(m_offsets[t_index], bshTexture->width, bshTexture->height, bshTexture->sprite->GetData());
+    }
+    else
+    {
+        const auto image{ GetCachedImage(m_cache, t_index) };
+        bshTexture->width = image.width;
+        bshTexture->height = image.height;
+        bshTexture->sprite = std::make_unique<olc::Sprite>(image.width, image.height);
+
+        std::memcpy(bshTexture->sprite->GetData(), m_cache.data() + image.pixelOffset, GetTextureBytes(*bshTexture));
+    }
+
+    return bshTexture;
+}
+
+std::pair<uint32_t, uint32_t> mdcii::resource::BshFile::ReadImageSize(const uint32_t t_offset) const
 {
-    const auto* offset{ &chunks.at(0)->data[t_offset] };
+    const auto data{ chunks.at(0).data };
+    if (t_offset > data.size() || data.size() - t_offset < IMAGE_HEADER_SIZE)
+    {
+        throw MDCII_EXCEPTION("[BshFile::ReadImageSize()] Invalid offset.");
+    }
 
-    const auto width{ *reinterpret_cast<const uint32_t*>(offset) };
-    const auto height{ *reinterpret_cast<const uint32_t*>((offset += sizeof(uint32_t))) };
-    const auto type{ *reinterpret_cast<const uint32_t*>((offset += sizeof(uint32_t))) };
-    const auto len{ *reinterpret_cast<const uint32_t*>((offset += sizeof(uint32_t))) };
+    // type and length of the header are not needed
+    const auto width{ ReadUint32(data, t_offset) };
+    const auto height{ ReadUint32(data, t_offset + sizeof(uint32_t)) };
 
     if (width <= 0 || height <= 0)
     {
-        throw MDCII_EXCEPTION("[BshFile::DecodePixelData()] Invalid width or height.");
+        throw MDCII_EXCEPTION("[BshFile::ReadImageSize()] Invalid width or height.");
     }
 
-    auto bshTexture{ std::make_unique<BshTexture>() };
-    bshTexture->width = width;
-    bshTexture->height = height;
-    bshTexture->pixels.resize(static_cast<size_t>(width) * height, { 0, 0, 0, 0 });
+    return { width, height };
+}
 
-    auto x{ 0 };
-    auto y{ 0 };
+void mdcii::resource::BshFile::DecodePixelData(const uint32_t t_offset, const uint32_t t_width, const uint32_t t_height, olc::Pixel* t_pixels) const
+{
+    const auto data{ chunks.at(0).data };
+
+    // the skipped pixels are transparent
+    std::fill_n(t_pixels, static_cast<size_t>(t_width) * t_height, olc::BLANK);
 
-    offset += 3;
+    uint32_t x{ 0 };
+    uint32_t y{ 0 };
+    auto position{ static_cast<size_t>(t_offset) + IMAGE_HEADER_SIZE };
 
     while (true)
     {
-        const auto numAlpha{ static_cast<uint8_t>(*(offset += sizeof(uint8_t))) };
+        if (position >= data.size())
+        {
+            throw MDCII_EXCEPTION("[BshFile::DecodePixelData()] Missing end marker.");
+        }
+
+        const auto numAlpha{ data[position++] };
 
         if (numAlpha == END_MARKER)
         {
@@ -124,37 +244,203 @@ void mdcii::resource::BshFile::DecodePixelData(const uint32_t t_offset)
             continue;
         }
 
-        for (auto i{ 0 }; i < numAlpha; ++i)
+        x += numAlpha;
+
+        if (position >= data.size())
         {
-            x++;
+            throw MDCII_EXCEPTION("[BshFile::DecodePixelData()] Missing number of pixels.");
         }
 
-        const auto numPixels{ static_cast<uint8_t>(*(offset += sizeof(uint8_t))) };
-        for (auto i{ 0 }; i < numPixels; ++i)
+        const auto numPixels{ data[position++] };
+
+        if (y >= t_height || x + numPixels > t_width || data.size() - position < numPixels)
         {
-            const auto colorIndex{ static_cast<uint8_t>(*(offset += sizeof(uint8_t))) };
-            bshTexture->pixels[static_cast<size_t>(y) * width + x] = m_palette[colorIndex];
-            x++;
+            throw MDCII_EXCEPTION("[BshFile::DecodePixelData()] Pixels outside the image.");
         }
+
+        // expand the color indices of the run
+        std::ranges::transform(
+            data.subspan(position, numPixels),
+            t_pixels + static_cast<size_t>(y) * t_width + x,
+            [this](const uint8_t t_colorIndex) { return m_palette[t_colorIndex]; }
+        );
+
+        position += numPixels;
+        x += numPixels;
     }
+}
 
-    bshTextures.push_back(std::move(bshTexture));
+void mdcii::resource::BshFile::ForEach(const int t_count, const std::function<void(int)>& t_func) const
+{
+    if (m_jobSystem)
+    {
+        m_jobSystem->ParallelFor(t_count, t_func);
+    }
+    else
+    {
+        for (auto i{ 0 }; i < t_count; ++i)
+        {
+            t_func(i);
+        }
+    }
+}
+
+uint32_t mdcii::resource::BshFile::ReadUint32(const std::span<const uint8_t> t_data, const std::size_t t_offset)
+{
+    uint32_t value;
+    std::memcpy(&value, t_data.data() + t_offset, sizeof(value));
+
+    return value;
+}
+
+void mdcii::resource::BshFile::AddTexture(const int t_index, std::unique_ptr<BshTexture> t_texture)
+{
+    t_texture->decal = std::make_unique<olc::Decal>(t_texture->sprite.get());
+
+    m_residentBytes += GetTextureBytes(*t_texture);
+    m_textures[t_index] = std::move(t_texture);
+
+    m_lru.push_front(t_index);
+    m_lruPositions[t_index] = m_lru.begin();
+}
+
+void mdcii::resource::BshFile::TouchTexture(const int t_index)
+{
+    m_lru.splice(m_lru.begin(), m_lru, m_lruPositions[t_index]);
+}
+
+void mdcii::resource::BshFile::CheckIndex(const int t_index) const
+{
+    if (t_index < 0 || t_index >= GetNrOfTextures())
+    {
+        throw MDCII_EXCEPTION("[BshFile::CheckIndex()] Invalid image index " + std::to_string(t_index) + ".");
+    }
 }
 
-void mdcii::resource::BshFile::CreateRenderables() const
+std::size_t mdcii::resource::BshFile::GetTextureBytes(const BshTexture& t_texture)
+{
+    return static_cast<std::size_t>(t_texture.width) * t_texture.height * sizeof(olc::Pixel);
+}
+
+//-------------------------------------------------
+// Cache
+//-------------------------------------------------
+
+void mdcii::resource::BshFile::LoadCache()
 {
-    for (const auto& texture : bshTextures)
+    MDCII_PROFILE_SCOPE("BshFile::LoadCache");
+
+    const auto name{ GetCacheName() };
+    const auto key{ AssetCache::CreateKey({
+        chunks.at(0).data,
+        { reinterpret_cast<const uint8_t*>(m_palette.data()), m_palette.size() * sizeof(olc::Pixel) }
+    }) };
+
+    m_cacheFile = AssetCache::Load(name, key);
+    if (!m_cacheFile || !IsValidCache(AssetCache::GetPayload(*m_cacheFile)))
     {
-        texture->sprite = std::make_unique<olc::Sprite>(texture->width, texture->height);
+        // the entry must be unmapped before it can be replaced
+        m_cacheFile.reset();
+
+        // without a cache the images are decoded on demand, so decoding all of them would be wasted
+        if (!AssetCache::IsWritable())
+        {
+            return;
+        }
+
+        MDCII_LOG_INFO("[BshFile::LoadCache()] Decode all images of {} ...", filePath);
+
+        if (!AssetCache::Store(name, key, CreateCache()))
+        {
+            return;
+        }
 
-        for (int y{ 0 }; y < static_cast<int>(texture->height); ++y)
+        m_cacheFile = AssetCache::Load(name, key);
+        if (!m_cacheFile || !IsValidCache(AssetCache::GetPayload(*m_cacheFile)))
         {
-            for (int x{ 0 }; x < static_cast<int>(texture->width); ++x)
-            {
-                texture->sprite->SetPixel(x, y, texture->pixels[static_cast<size_t>(y) * texture->width + x]);
-            }
+            m_cacheFile.reset();
+            return;
         }
+    }
+
+    m_cache = AssetCache::GetPayload(*m_cacheFile);
+
+    // the images are copied from the cache from now on
+    CloseFile();
+
+    MDCII_LOG_DEBUG("[BshFile::LoadCache()] The images of {} are read from the cache.", filePath);
+}
+
+std::vector<uint8_t> mdcii::resource::BshFile::CreateCache() const
+{
+    MDCII_PROFILE_SCOPE("BshFile::CreateCache");
+
+    const auto count{ static_cast<uint32_t>(m_offsets.size()) };
+
+    // the pixels of each image follow the descriptions
+    std::vector<CachedImage> images(count);
+    uint64_t pixelOffset{ CACHE_HEADER_SIZE + count * sizeof(CachedImage) };
+    for (auto i{ 0u }; i < count; ++i)
+    {
+        const auto [width, height]{ ReadImageSize(m_offsets[i]) };
+        images[i] = { width, height, pixelOffset };
+        pixelOffset += static_cast<uint64_t>(width) * height * sizeof(olc::Pixel);
+    }
+
+    std::vector<uint8_t> cache(pixelOffset);
+    std::memcpy(cache.data(), &count, sizeof(count));
+    std::memcpy(cache.data() + CACHE_HEADER_SIZE, images.data(), images.size() * sizeof(CachedImage));
+
+    // each job writes the pixels of its own image
+    ForEach(static_cast<int>(count), [&](const int t_index) {
+        const auto& image{ images[t_index] };
+        DecodePixelData(m_offsets[t_index], image.width, image.height, reinterpret_cast<olc::Pixel*>(cache.data() + image.pixelOffset));
+    });
+
+    return cache;
+}
+
+bool mdcii::resource::BshFile::IsValidCache(const std::span<const uint8_t> t_cache) const
+{
+    if (t_cache.size() < CACHE_HEADER_SIZE)
+    {
+        return false;
+    }
+
+    uint32_t count;
+    std::memcpy(&count, t_cache.data(), sizeof(count));
+
+    if (count != m_offsets.size() || (t_cache.size() - CACHE_HEADER_SIZE) / sizeof(CachedImage) < count)
+    {
+        return false;
+    }
 
-        texture->decal = std::make_unique<olc::Decal>(texture->sprite.get());
+    for (auto i{ 0 }; i < static_cast<int>(count); ++i)
+    {
+        const auto image{ GetCachedImage(t_cache, i) };
+        const auto bytes{ static_cast<uint64_t>(image.width) * image.height * sizeof(olc::Pixel) };
+
+        if (image.width == 0 || image.height == 0 || image.pixelOffset % alignof(olc::Pixel) != 0 ||
+            image.pixelOffset > t_cache.size() || t_cache.size() - image.pixelOffset < bytes)
+        {
+            return false;
+        }
     }
+
+    return true;
+}
+
+mdcii::resource::BshFile::CachedImage mdcii::resource::BshFile::GetCachedImage(const std::span<const uint8_t> t_cache, const int t_index)
+{
+    CachedImage image;
+    std::memcpy(&image, t_cache.data() + CACHE_HEADER_SIZE + t_index * sizeof(CachedImage), sizeof(CachedImage));
+
+    return image;
+}
+
+std::string mdcii::resource::BshFile::GetCacheName() const
+{
+    const std::filesystem::path path{ filePath };
+
+    return to_lower_case(path.parent_path().filename().string() + "_" + path.stem().string());
 }
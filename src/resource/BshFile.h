@@ -18,9 +18,23 @@
 
 #pragma once
 
+#include <functional>
+#include <list>
 #include "BinaryFile.h"
 #include "vendor/olc/olcPixelGameEngine.h"
 
+//-------------------------------------------------
+// Forward declarations
+//-------------------------------------------------
+
+namespace mdcii::job
+{
+    /**
+     * @brief Forward declaration class JobSystem.
+     */
+    class JobSystem;
+}
+
 namespace mdcii::resource
 {
     //-------------------------------------------------
@@ -32,11 +46,6 @@ namespace mdcii::resource
      */
     struct BshTexture
     {
-        /**
-         * @brief The gfx pixels.
-         */
-        std::vector<olc::Pixel> pixels;
-
         /**
          * @brief The gfx width.
          */
@@ -48,7 +57,7 @@ namespace mdcii::resource
         uint32_t height{ 0 };
 
         /**
-         * @brief Gfx stored as an Olc Sprite.
+         * @brief Gfx stored as an Olc Sprite; the only copy of the pixels.
          */
         std::unique_ptr<olc::Sprite> sprite;
 
@@ -64,19 +73,17 @@ namespace mdcii::resource
 
     /**
      * @brief The class loads a Bsh file.
+     *
+     * The images are decoded the first time they are requested. The least recently
+     * used images are released when the resident images exceed a memory budget.
+     *
+     * All decoded images are stored in the AssetCache, keyed by the bytes of the file
+     * and the palette. If a valid cache entry exists, the images are copied from the
+     * mapped entry and the file itself is closed.
      */
     class BshFile : public BinaryFile
     {
     public:
-        //-------------------------------------------------
-        // Member
-        //-------------------------------------------------
-
-        /**
-         * @brief A list with BshTexture objects.
-         */
-        std::vector<std::unique_ptr<BshTexture>> bshTextures;
-
         //-------------------------------------------------
         // Ctors. / Dtor.
         //-------------------------------------------------
@@ -88,8 +95,10 @@ namespace mdcii::resource
          *
          * @param t_filePath The path to the Bsh file.
          * @param t_palette The palette containing the RGBA values of each color.
+         * @param t_jobSystem Pointer to the JobSystem that decodes the images or nullptr to decode them on the calling thread.
+         * @param t_budget The memory budget in bytes of the resident images.
          */
-        explicit BshFile(std::string t_filePath, std::vector<olc::Pixel> t_palette);
+        BshFile(std::string t_filePath, std::vector<olc::Pixel> t_palette, job::JobSystem* t_jobSystem, std::size_t t_budget);
 
         BshFile(const BshFile& t_other) = delete;
         BshFile(BshFile&& t_other) noexcept = delete;
@@ -98,12 +107,66 @@ namespace mdcii::resource
 
         ~BshFile() noexcept override;
 
+        //-------------------------------------------------
+        // Getter
+        //-------------------------------------------------
+
+        /**
+         * @brief Getter for the number of images in the file.
+         *
+         * @return The number of images.
+         */
+        [[nodiscard]] int GetNrOfTextures() const { return static_cast<int>(m_offsets.size()); }
+
+        /**
+         * @brief Getter for the number of bytes of the resident images.
+         *
+         * @return The number of bytes.
+         */
+        [[nodiscard]] std::size_t GetResidentBytes() const { return m_residentBytes; }
+
+        //-------------------------------------------------
+        // Textures
+        //-------------------------------------------------
+
+        /**
+         * @brief Returns an image and decodes it on first use.
+         *
+         * Must be called on the thread that owns the renderer.
+         * The image stays valid until the next `ReleaseUnusedTextures()`.
+         *
+         * @param t_index The index of the image.
+         *
+         * @return Pointer to the BshTexture object.
+         */
+        [[nodiscard]] const BshTexture* GetTexture(int t_index);
+
+        /**
+         * @brief Decodes the missing images of the given indices in parallel.
+         *
+         * Must be called on the thread that owns the renderer.
+         *
+         * @param t_indices The indices of the images.
+         */
+        void Prefetch(const std::vector<int>& t_indices);
+
+        /**
+         * @brief Releases the least recently used images until the resident images fit into the budget.
+         *
+         * Should be called before the images of a new frame are requested,
+         * so that no image of the current frame is released.
+         */
+        void ReleaseUnusedTextures();
+
         //-------------------------------------------------
         // Override
         //-------------------------------------------------
 
         /**
-         * @brief Reads the data from the Chunk objects.
+         * @brief Reads the offsets of the images from the Chunk objects and maps the cached images.
+         *
+         * On a cache miss all images are decoded once and stored in the cache.
+         * If the cache cannot be used, the images are decoded on demand.
          */
         void ReadDataFromChunks() override;
 
@@ -129,6 +192,41 @@ namespace mdcii::resource
          */
         static constexpr std::string_view CHUNK_ID{ "BSH" };
 
+        /**
+         * @brief The size in bytes of an image header: width, height, type and length.
+         */
+        static constexpr uint32_t IMAGE_HEADER_SIZE{ 4 * sizeof(uint32_t) };
+
+        /**
+         * @brief The size in bytes of the cache header: the number of images and a padding.
+         */
+        static constexpr uint32_t CACHE_HEADER_SIZE{ 2 * sizeof(uint32_t) };
+
+        //-------------------------------------------------
+        // CachedImage
+        //-------------------------------------------------
+
+        /**
+         * @brief Describes an image in the cache.
+         */
+        struct CachedImage
+        {
+            /**
+             * @brief The image width.
+             */
+            uint32_t width{ 0 };
+
+            /**
+             * @brief The image height.
+             */
+            uint32_t height{ 0 };
+
+            /**
+             * @brief The offset of the RGBA pixels from the start of the cached bytes.
+             */
+            uint64_t pixelOffset{ 0 };
+        };
+
         //-------------------------------------------------
         // Member
         //-------------------------------------------------
@@ -143,22 +241,171 @@ namespace mdcii::resource
          */
         std::vector<uint32_t> m_offsets;
 
+        /**
+         * @brief Pointer to the JobSystem that decodes the images.
+         */
+        job::JobSystem* m_jobSystem{ nullptr };
+
+        /**
+         * @brief The memory budget in bytes of the resident images.
+         */
+        std::size_t m_budget{ 0 };
+
+        /**
+         * @brief The number of bytes of the resident images.
+         */
+        std::size_t m_residentBytes{ 0 };
+
+        /**
+         * @brief A slot for each image; nullptr if the image is not resident.
+         */
+        std::vector<std::unique_ptr<BshTexture>> m_textures;
+
+        /**
+         * @brief The indices of the resident images, the most recently used first.
+         */
+        std::list<int> m_lru;
+
+        /**
+         * @brief The position of each resident image in `m_lru`.
+         */
+        std::vector<std::list<int>::iterator> m_lruPositions;
+
+        /**
+         * @brief The mapped cache entry or nullptr if the images are decoded from the file.
+         */
+        std::unique_ptr<MappedFile> m_cacheFile;
+
+        /**
+         * @brief The cached bytes of the mapped entry.
+         */
+        std::span<const uint8_t> m_cache;
+
         //-------------------------------------------------
         // Helper
         //-------------------------------------------------
 
         /**
-         * @brief Reads the pixel values from the first Chunk and uses it to create BshTexture objects.
+         * @brief Creates a BshTexture object with its sprite from the cache or the first Chunk.
+         *
+         * Only reads shared data, so that several images can be created at the same time.
+         *
+         * @param t_index The index of the image.
+         *
+         * @return The BshTexture object with its sprite.
+         */
+        [[nodiscard]] std::unique_ptr<BshTexture> CreateTexture(int t_index) const;
+
+        /**
+         * @brief Reads the width and height of an image from the first Chunk.
          *
-         * The BshTexture objects are stored in bshTextures.
+         * @param t_offset The offset to a Bsh image.
+         *
+         * @return The width and height.
+         */
+        [[nodiscard]] std::pair<uint32_t, uint32_t> ReadImageSize(uint32_t t_offset) const;
+
+        /**
+         * @brief Reads the pixel values of an image from the first Chunk.
+         *
+         * The runs of pixels are written straight into the given memory.
          *
          * @param t_offset The offset to a Bsh image.
+         * @param t_width The image width.
+         * @param t_height The image height.
+         * @param t_pixels The memory for `t_width * t_height` pixels.
+         */
+        void DecodePixelData(uint32_t t_offset, uint32_t t_width, uint32_t t_height, olc::Pixel* t_pixels) const;
+
+        /**
+         * @brief Runs a function for each index, in parallel if there is a JobSystem.
+         *
+         * @param t_count The number of indices.
+         * @param t_func The function to run.
          */
-        void DecodePixelData(uint32_t t_offset);
+        void ForEach(int t_count, const std::function<void(int)>& t_func) const;
 
         /**
-         * @brief Makes the BshTexture pixel data accessible.
+         * @brief Reads an unaligned 32-bit value.
+         *
+         * @param t_data The bytes to read from.
+         * @param t_offset The offset of the value.
+         *
+         * @return The value.
+         */
+        [[nodiscard]] static uint32_t ReadUint32(std::span<const uint8_t> t_data, std::size_t t_offset);
+
+        /**
+         * @brief Creates the decal of a decoded image and makes it resident.
+         *
+         * @param t_index The index of the image.
+         * @param t_texture The decoded image.
+         */
+        void AddTexture(int t_index, std::unique_ptr<BshTexture> t_texture);
+
+        /**
+         * @brief Marks a resident image as most recently used.
+         *
+         * @param t_index The index of the image.
+         */
+        void TouchTexture(int t_index);
+
+        /**
+         * @brief Throws an exception if there is no image with the given index.
+         *
+         * @param t_index The index of the image.
+         */
+        void CheckIndex(int t_index) const;
+
+        /**
+         * @brief Calculates the memory used by an image.
+         *
+         * @param t_texture The image.
+         *
+         * @return The number of bytes.
+         */
+        [[nodiscard]] static std::size_t GetTextureBytes(const BshTexture& t_texture);
+
+        //-------------------------------------------------
+        // Cache
+        //-------------------------------------------------
+
+        /**
+         * @brief Maps the cached images and creates the cache entry if necessary.
+         */
+        void LoadCache();
+
+        /**
+         * @brief Decodes all images into the layout of a cache entry.
+         *
+         * @return The bytes to store.
+         */
+        [[nodiscard]] std::vector<uint8_t> CreateCache() const;
+
+        /**
+         * @brief Checks whether cached bytes contain every image of the file.
+         *
+         * @param t_cache The cached bytes.
+         *
+         * @return True if the bytes are valid; otherwise false.
+         */
+        [[nodiscard]] bool IsValidCache(std::span<const uint8_t> t_cache) const;
+
+        /**
+         * @brief Reads the description of an image from cached bytes.
+         *
+         * @param t_cache The cached bytes.
+         * @param t_index The index of the image.
+         *
+         * @return The description of the image.
+         */
+        [[nodiscard]] static CachedImage GetCachedImage(std::span<const uint8_t> t_cache, int t_index);
+
+        /**
+         * @brief Creates the name of the cache entry from the zoom directory and the file name, e.g. `gfx_bauhaus`.
+         *
+         * @return The name.
          */
-        void CreateRenderables() const;
+        [[nodiscard]] std::string GetCacheName() const;
     };
 }
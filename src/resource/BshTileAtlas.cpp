@@ -17,6 +17,7 @@
 // Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
 
 #include "BshTileAtlas.h"
+#include "Profiler.h"
 #include "Game.h"
 #include "MdciiException.h"
 #include "MdciiUtils.h"
@@ -74,6 +75,8 @@ olc::vi2d mdcii::resource::BshTileAtlas::GetAtlasOffset(const int t_gfx, const i
 
 void mdcii::resource::BshTileAtlas::Init()
 {
+    MDCII_PROFILE_SCOPE("BshTileAtlas::Init");
+
     MDCII_LOG_DEBUG("[BshTileAtlas::Init()] Start initialization of the Bsh Tile Atlas ...");
 
     LoadAtlasImages();
@@ -111,10 +114,16 @@ void mdcii::resource::BshTileAtlas::LoadAtlasImagesByZoom(const world::Zoom t_zo
     for (auto i{ 0 }; i < m_nrImages.at(zoomInt); ++i)
     {
         auto renderable{ std::make_unique<olc::Renderable>() };
+
+#if defined(OLC_PGE_HEADLESS)
+        // without a renderer there is nothing to upload; an empty image keeps one decal per atlas image
+        renderable->Create(1, 1);
+#else
         if(renderable->Load(fmt::format("{}atlas/{}/{}/{}.png", Game::RESOURCES_REL_PATH, zoomStr, m_atlasPath, i)) != olc::OK)
         {
             throw MDCII_EXCEPTION("[BshTileAtlas::LoadAtlasImagesByZoom()] Error while loading Bsh Tile Atlas file.");
         }
+#endif
 
         MDCII_ASSERT(renderable->Decal(), "[BshTileAtlas::LoadAtlasImagesByZoom()] Null pointer.")
 
@@ -17,6 +17,7 @@
 // Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
 
 #include "Buildings.h"
+#include "Profiler.h"
 #include "Log.h"
 #include "cod/CodParser.h"
 #include "vendor/enum/magic_enum.hpp"
@@ -40,6 +41,8 @@ std::vector<std::pair<int, int>> mdcii::resource::Building::CreateBuildingStartO
 
 mdcii::resource::Buildings::Buildings(const std::string& t_codFilePath)
 {
+    MDCII_PROFILE_SCOPE("Buildings::Buildings");
+
     MDCII_LOG_DEBUG("[Buildings::Buildings()] Create Buildings.");
 
     GenerateBuildings(t_codFilePath);
@@ -441,6 +444,8 @@ mdcii::resource::Building mdcii::resource::Buildings::GenerateBuilding(const cod
 
 mdcii::resource::Figures::Figures(const std::string& t_codFilePath)
 {
+    MDCII_PROFILE_SCOPE("Figures::Figures");
+
     MDCII_LOG_DEBUG("[Figures::Figures()] Create Figures.");
 
     GenerateFigures(t_codFilePath);
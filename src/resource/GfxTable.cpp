@@ -0,0 +1,142 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#include "GfxTable.h"
+#include "Buildings.h"
+#include "BuildingIds.h"
+#include "MdciiAssert.h"
+#include "world/Rotation.h"
+
+//-------------------------------------------------
+// Create
+//-------------------------------------------------
+
+void mdcii::resource::GfxTable::Create(const Buildings& t_buildings)
+{
+    MDCII_LOG_DEBUG("[GfxTable::Create()] Create the gfx table.");
+
+    static constexpr auto NR_OF_ROTATIONS{ static_cast<int>(magic_enum::enum_count<world::Rotation>()) };
+
+    m_entries.clear();
+    m_buildingIndices.clear();
+    m_roadIndices.clear();
+
+    for (const auto& [id, building] : t_buildings.buildingsMap)
+    {
+        m_buildingIndices.emplace(id, static_cast<int32_t>(m_entries.size()));
+
+        for (auto rotation{ 0 }; rotation < NR_OF_ROTATIONS; ++rotation)
+        {
+            for (auto y{ 0 }; y < std::max(1, building.size.h); ++y)
+            {
+                for (auto x{ 0 }; x < std::max(1, building.size.w); ++x)
+                {
+                    m_entries.push_back(CreateEntry(building, x, y, rotation));
+                }
+            }
+        }
+    }
+
+    // the traffic gfx replaces the gfx of the first rotation
+    for (const auto roadId : ROAD_BUILDING_IDS)
+    {
+        const auto& building{ t_buildings.buildingsMap.at(roadId) };
+        m_roadIndices.emplace(roadId, static_cast<int32_t>(m_entries.size()));
+
+        for (auto roadGfx{ magic_enum::enum_integer(RoadGfx::ROAD_WE) }; roadGfx <= magic_enum::enum_integer(RoadGfx::ROAD_X); ++roadGfx)
+        {
+            auto entry{ CreateEntry(building, 0, 0, 0) };
+            entry.gfxs[0] = roadGfx + (roadId == DIRT_ROAD_ID ? 20 : 0);
+            m_entries.push_back(entry);
+        }
+    }
+
+    MDCII_LOG_DEBUG("[GfxTable::Create()] The gfx table contains {} entries.", m_entries.size());
+}
+
+//-------------------------------------------------
+// Getter
+//-------------------------------------------------
+
+int32_t mdcii::resource::GfxTable::GetIndex(const Building* t_building, const int t_x, const int t_y, const int t_rotation)
+{
+    MDCII_ASSERT(t_building, "[GfxTable::GetIndex()] Null pointer.")
+    MDCII_ASSERT(m_buildingIndices.count(t_building->id), "[GfxTable::GetIndex()] Missing building.")
+    MDCII_ASSERT(t_rotation >= 0 && t_rotation < static_cast<int>(magic_enum::enum_count<world::Rotation>()), "[GfxTable::GetIndex()] Invalid rotation.")
+
+    const auto width{ std::max(1, t_building->size.w) };
+    const auto height{ std::max(1, t_building->size.h) };
+
+    MDCII_ASSERT(t_x >= 0 && t_x < width && t_y >= 0 && t_y < height, "[GfxTable::GetIndex()] Invalid position.")
+
+    return m_buildingIndices.at(t_building->id) + (t_rotation * height + t_y) * width + t_x;
+}
+
+int32_t mdcii::resource::GfxTable::GetRoadIndex(const Building* t_building, const RoadGfx t_roadGfx)
+{
+    MDCII_ASSERT(t_building, "[GfxTable::GetRoadIndex()] Null pointer.")
+    MDCII_ASSERT(m_roadIndices.count(t_building->id), "[GfxTable::GetRoadIndex()] Missing road building.")
+
+    // the entries of a road building are in the order of the road gfx
+    return m_roadIndices.at(t_building->id) + magic_enum::enum_integer(t_roadGfx) - magic_enum::enum_integer(RoadGfx::ROAD_WE);
+}
+
+//-------------------------------------------------
+// Helper
+//-------------------------------------------------
+
+mdcii::resource::TileGfx mdcii::resource::GfxTable::CreateEntry(const Building& t_building, const int t_x, const int t_y, const int t_rotation)
+{
+    TileGfx entry;
+    entry.nrOfGfxs = t_building.IsRotatable() ? static_cast<uint8_t>(entry.gfxs.size()) : 1;
+    entry.elevated = t_building.posoffs > 0;
+    entry.animAdd = t_building.animAdd;
+
+    const auto offset{ t_building.IsBig() ? CalcBigBuildingOffset(t_building, t_x, t_y, t_rotation) : 0 };
+    for (auto i{ 0 }; i < entry.nrOfGfxs; ++i)
+    {
+        entry.gfxs[i] = t_building.gfx + (i * t_building.rotate) + offset;
+    }
+
+    return entry;
+}
+
+int mdcii::resource::GfxTable::CalcBigBuildingOffset(const Building& t_building, const int t_x, const int t_y, const int t_rotation)
+{
+    // default: orientation 0
+    auto rp{ olc::vi2d(t_x, t_y) };
+
+    using enum world::Rotation;
+
+    if (t_rotation == magic_enum::enum_integer(DEG270))
+    {
+        rp = world::rotate_position(t_x, t_y, t_building.size.w, t_building.size.h, DEG90);
+    }
+
+    if (t_rotation == magic_enum::enum_integer(DEG180))
+    {
+        rp = world::rotate_position(t_x, t_y, t_building.size.w, t_building.size.h, DEG180);
+    }
+
+    if (t_rotation == magic_enum::enum_integer(DEG90))
+    {
+        rp = world::rotate_position(t_x, t_y, t_building.size.w, t_building.size.h, DEG270);
+    }
+
+    return rp.y * t_building.size.w + rp.x;
+}
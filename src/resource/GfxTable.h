@@ -0,0 +1,184 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#pragma once
+
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+#include "BuildingIds.h"
+
+namespace mdcii::resource
+{
+    //-------------------------------------------------
+    // Forward declarations
+    //-------------------------------------------------
+
+    /**
+     * @brief Forward declaration struct Building.
+     */
+    struct Building;
+
+    /**
+     * @brief Forward declaration class Buildings.
+     */
+    class Buildings;
+
+    //-------------------------------------------------
+    // TileGfx
+    //-------------------------------------------------
+
+    /**
+     * @brief The gfx values shared by all tiles of the same building part.
+     */
+    struct TileGfx
+    {
+        /**
+         * @brief The gfx for each rotation; only the first `nrOfGfxs` values are valid.
+         */
+        std::array<int, 4> gfxs{};
+
+        /**
+         * @brief The number of valid values in `gfxs`.
+         */
+        uint8_t nrOfGfxs{ 0 };
+
+        /**
+         * @brief True if the building is above water and coast and must be raised.
+         */
+        bool elevated{ false };
+
+        /**
+         * @brief The gfx offset between two animation frames.
+         */
+        int animAdd{ 0 };
+    };
+
+    //-------------------------------------------------
+    // GfxTable
+    //-------------------------------------------------
+
+    /**
+     * @brief An immutable table with the gfx values for each building, local position and rotation.
+     *
+     * The table is created once after loading the buildings. Tiles only store the
+     * index of their entry.
+     */
+    class GfxTable
+    {
+    public:
+        //-------------------------------------------------
+        // Create
+        //-------------------------------------------------
+
+        /**
+         * @brief Creates the entries for all buildings and road variants.
+         *
+         * @param t_buildings The buildings from the haeuser.cod.
+         */
+        static void Create(const Buildings& t_buildings);
+
+        //-------------------------------------------------
+        // Getter
+        //-------------------------------------------------
+
+        /**
+         * @brief Returns the entry index for a part of a building.
+         *
+         * @param t_building Pointer to the Building object.
+         * @param t_x The x position of the tile in local/object space of the building.
+         * @param t_y The y position of the tile in local/object space of the building.
+         * @param t_rotation The rotation of the building.
+         *
+         * @return The index of the entry.
+         */
+        [[nodiscard]] static int32_t GetIndex(const Building* t_building, int t_x, int t_y, int t_rotation);
+
+        /**
+         * @brief Returns the entry index for a road building with the given road gfx for the first rotation.
+         *
+         * @param t_building Pointer to the road Building object.
+         * @param t_roadGfx The road gfx, which is shifted for a dirt road.
+         *
+         * @return The index of the entry.
+         */
+        [[nodiscard]] static int32_t GetRoadIndex(const Building* t_building, RoadGfx t_roadGfx);
+
+        /**
+         * @brief Returns an entry.
+         *
+         * @param t_index The index of the entry.
+         *
+         * @return The entry.
+         */
+        [[nodiscard]] static const TileGfx& Get(const int32_t t_index) { return m_entries[t_index]; }
+
+    protected:
+
+    private:
+        //-------------------------------------------------
+        // Member
+        //-------------------------------------------------
+
+        /**
+         * @brief All entries.
+         */
+        inline static std::vector<TileGfx> m_entries;
+
+        /**
+         * @brief The index of the first entry of each building Id.
+         *
+         * A building has an entry for each rotation and local position.
+         */
+        inline static std::unordered_map<int, int32_t> m_buildingIndices;
+
+        /**
+         * @brief The index of the entry of the first road gfx of each road building.
+         */
+        inline static std::unordered_map<int, int32_t> m_roadIndices;
+
+        //-------------------------------------------------
+        // Helper
+        //-------------------------------------------------
+
+        /**
+         * @brief Calculates the entry for a part of a building.
+         *
+         * @param t_building The Building object.
+         * @param t_x The x position of the tile in local/object space of the building.
+         * @param t_y The y position of the tile in local/object space of the building.
+         * @param t_rotation The rotation of the building.
+         *
+         * @return The new entry.
+         */
+        [[nodiscard]] static TileGfx CreateEntry(const Building& t_building, int t_x, int t_y, int t_rotation);
+
+        /**
+         * @brief Calculates the gfx offset of a tile of a large building.
+         *
+         * @param t_building The Building object.
+         * @param t_x The x position of the tile in local/object space of the building.
+         * @param t_y The y position of the tile in local/object space of the building.
+         * @param t_rotation The rotation of the building.
+         *
+         * @return The offset to add to the gfx of the building.
+         */
+        [[nodiscard]] static int CalcBigBuildingOffset(const Building& t_building, int t_x, int t_y, int t_rotation);
+    };
+}
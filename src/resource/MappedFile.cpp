@@ -0,0 +1,144 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#if defined(_WIN64)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include "MappedFile.h"
+#include "Log.h"
+#include "MdciiException.h"
+
+//-------------------------------------------------
+// Ctors. / Dtor.
+//-------------------------------------------------
+
+#if defined(_WIN64)
+
+mdcii::resource::MappedFile::MappedFile(const std::string& t_filePath)
+{
+    MDCII_LOG_DEBUG("[MappedFile::MappedFile()] Create MappedFile.");
+
+    auto* fileHandle{ CreateFileA(t_filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr) };
+    if (fileHandle == INVALID_HANDLE_VALUE)
+    {
+        throw MDCII_EXCEPTION("[MappedFile::MappedFile()] Error while opening file " + t_filePath + ".");
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(fileHandle, &size))
+    {
+        CloseHandle(fileHandle);
+        throw MDCII_EXCEPTION("[MappedFile::MappedFile()] Error while reading the size of file " + t_filePath + ".");
+    }
+
+    m_size = static_cast<std::size_t>(size.QuadPart);
+
+    // an empty file cannot be mapped
+    if (m_size > 0)
+    {
+        m_mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (m_mappingHandle)
+        {
+            m_data = static_cast<const uint8_t*>(MapViewOfFile(m_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+        }
+    }
+
+    // the mapping keeps the file open
+    CloseHandle(fileHandle);
+
+    if (m_size > 0 && !m_data)
+    {
+        if (m_mappingHandle)
+        {
+            CloseHandle(m_mappingHandle);
+        }
+
+        throw MDCII_EXCEPTION("[MappedFile::MappedFile()] Error while mapping file " + t_filePath + ".");
+    }
+}
+
+mdcii::resource::MappedFile::~MappedFile() noexcept
+{
+    MDCII_LOG_DEBUG("[MappedFile::~MappedFile()] Destruct MappedFile.");
+
+    if (m_data)
+    {
+        UnmapViewOfFile(m_data);
+        CloseHandle(m_mappingHandle);
+    }
+}
+
+#else
+
+mdcii::resource::MappedFile::MappedFile(const std::string& t_filePath)
+{
+    MDCII_LOG_DEBUG("[MappedFile::MappedFile()] Create MappedFile.");
+
+    const auto fd{ open(t_filePath.c_str(), O_RDONLY) };
+    if (fd == -1)
+    {
+        throw MDCII_EXCEPTION("[MappedFile::MappedFile()] Error while opening file " + t_filePath + ".");
+    }
+
+    struct stat fileStat{};
+    if (fstat(fd, &fileStat) == -1)
+    {
+        close(fd);
+        throw MDCII_EXCEPTION("[MappedFile::MappedFile()] Error while reading the size of file " + t_filePath + ".");
+    }
+
+    m_size = static_cast<std::size_t>(fileStat.st_size);
+
+    // an empty file cannot be mapped
+    if (m_size > 0)
+    {
+        auto* data{ mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0) };
+        if (data == MAP_FAILED)
+        {
+            close(fd);
+            throw MDCII_EXCEPTION("[MappedFile::MappedFile()] Error while mapping file " + t_filePath + ".");
+        }
+
+        // the chunks are read from front to back
+        madvise(data, m_size, MADV_SEQUENTIAL);
+
+        m_data = static_cast<const uint8_t*>(data);
+    }
+
+    // the mapping keeps the file open
+    close(fd);
+}
+
+mdcii::resource::MappedFile::~MappedFile() noexcept
+{
+    MDCII_LOG_DEBUG("[MappedFile::~MappedFile()] Destruct MappedFile.");
+
+    if (m_data)
+    {
+        munmap(const_cast<uint8_t*>(m_data), m_size);
+    }
+}
+
+#endif
@@ -0,0 +1,95 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string>
+
+namespace mdcii::resource
+{
+    //-------------------------------------------------
+    // MappedFile
+    //-------------------------------------------------
+
+    /**
+     * @brief A read-only memory mapping of a whole file.
+     *
+     * The pages are loaded by the operating system on first access and are
+     * shared with its file cache, so the content is never copied.
+     */
+    class MappedFile
+    {
+    public:
+        //-------------------------------------------------
+        // Ctors. / Dtor.
+        //-------------------------------------------------
+
+        MappedFile() = delete;
+
+        /**
+         * @brief Constructs a new MappedFile object and maps the file.
+         *
+         * @param t_filePath The path to the file to map.
+         */
+        explicit MappedFile(const std::string& t_filePath);
+
+        MappedFile(const MappedFile& t_other) = delete;
+        MappedFile(MappedFile&& t_other) noexcept = delete;
+        MappedFile& operator=(const MappedFile& t_other) = delete;
+        MappedFile& operator=(MappedFile&& t_other) noexcept = delete;
+
+        ~MappedFile() noexcept;
+
+        //-------------------------------------------------
+        // Getter
+        //-------------------------------------------------
+
+        /**
+         * @brief Getter for the file content.
+         *
+         * @return The mapped bytes, valid as long as this object lives.
+         */
+        [[nodiscard]] std::span<const uint8_t> GetData() const { return { m_data, m_size }; }
+
+    protected:
+
+    private:
+        //-------------------------------------------------
+        // Member
+        //-------------------------------------------------
+
+        /**
+         * @brief The start of the mapping or nullptr for an empty file.
+         */
+        const uint8_t* m_data{ nullptr };
+
+        /**
+         * @brief The size of the file in bytes.
+         */
+        std::size_t m_size{ 0 };
+
+#if defined(_WIN64)
+        /**
+         * @brief The handle of the file mapping object.
+         */
+        void* m_mappingHandle{ nullptr };
+#endif
+    };
+}
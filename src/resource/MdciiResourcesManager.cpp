@@ -17,6 +17,7 @@
 // Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
 
 #include "MdciiResourcesManager.h"
+#include "Profiler.h"
 #include "Log.h"
 #include "MdciiUtils.h"
 
@@ -26,6 +27,8 @@
 
 mdcii::resource::MdciiResourcesManager::MdciiResourcesManager()
 {
+    MDCII_PROFILE_SCOPE("MdciiResourcesManager::MdciiResourcesManager");
+
     MDCII_LOG_DEBUG("[MdciiResourcesManager::MdciiResourcesManager()] Create MdciiResourcesManager.");
 
     ReadPaths();
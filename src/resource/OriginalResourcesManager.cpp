@@ -17,23 +17,35 @@
 // Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
 
 #include "OriginalResourcesManager.h"
+#include "Profiler.h"
 #include "Game.h"
 #include "MdciiException.h"
 #include "MdciiUtils.h"
 #include "MdciiAssert.h"
 #include "PaletteFile.h"
 #include "BshFile.h"
+#include "GfxTable.h"
+#include "AnimationClock.h"
 
 //-------------------------------------------------
 // Ctors. / Dtor.
 //-------------------------------------------------
 
-mdcii::resource::OriginalResourcesManager::OriginalResourcesManager()
+mdcii::resource::OriginalResourcesManager::OriginalResourcesManager(job::JobSystem* t_jobSystem)
 {
     MDCII_LOG_DEBUG("[OriginalResourcesManager::OriginalResourcesManager()] Create OriginalResourcesManager.");
 
     GetPathsFromOriginal();
-    LoadFiles();
+    LoadFiles(t_jobSystem);
+}
+
+mdcii::resource::OriginalResourcesManager::OriginalResourcesManager(std::filesystem::path t_buildingsPath, std::filesystem::path t_figuresPath)
+    : m_buildingsPath{ std::move(t_buildingsPath) }
+    , m_figuresPath{ std::move(t_figuresPath) }
+{
+    MDCII_LOG_DEBUG("[OriginalResourcesManager::OriginalResourcesManager()] Create OriginalResourcesManager with the buildings and figures only.");
+
+    LoadTables();
 }
 
 mdcii::resource::OriginalResourcesManager::~OriginalResourcesManager() noexcept
@@ -59,6 +71,18 @@ const mdcii::resource::Figure& mdcii::resource::OriginalResourcesManager::GetFig
     return figures->figuresMap.at(t_figureId);
 }
 
+//-------------------------------------------------
+// Bsh textures
+//-------------------------------------------------
+
+void mdcii::resource::OriginalResourcesManager::ReleaseUnusedBshTextures() const
+{
+    for (const auto& [zoom, bauhausBshFile] : bauhausBshFiles)
+    {
+        bauhausBshFile->ReleaseUnusedTextures();
+    }
+}
+
 //-------------------------------------------------
 // Path to the original data
 //-------------------------------------------------
@@ -194,14 +218,18 @@ void mdcii::resource::OriginalResourcesManager::FindPaletteFilePath()
 // Load original data
 //-------------------------------------------------
 
-void mdcii::resource::OriginalResourcesManager::LoadFiles()
+void mdcii::resource::OriginalResourcesManager::LoadFiles(job::JobSystem* t_jobSystem)
 {
+    MDCII_PROFILE_SCOPE("OriginalResourcesManager::LoadFiles");
+
     MDCII_LOG_DEBUG("[OriginalResourcesManager::LoadFiles()] Start loading files ...");
 
     m_paletteFile = std::make_unique<PaletteFile>(m_palettePath);
     m_paletteFile->ReadDataFromChunks();
+    m_paletteFile->CloseFile();
 
     // load bauhaus.bsh graphics
+    const auto budget{ static_cast<std::size_t>(Game::INI.Get<int>("menu", "bauhaus_budget_mb")) * 1024 * 1024 };
     for (const auto& [zoom, bauhausBshFilePath] : m_bauhausBshPaths)
     {
         if (bauhausBshFilePath.empty())
@@ -209,14 +237,23 @@ void mdcii::resource::OriginalResourcesManager::LoadFiles()
             throw MDCII_EXCEPTION("[OriginalResourcesManager::LoadFiles()] Error while reading bauhaus.bsh file path.");
         }
 
-        auto bauhausBshFile{ std::make_unique<BshFile>(bauhausBshFilePath, m_paletteFile->palette) };
+        // the file stays mapped, the images are decoded on demand
+        auto bauhausBshFile{ std::make_unique<BshFile>(bauhausBshFilePath, m_paletteFile->palette, t_jobSystem, budget) };
         bauhausBshFile->ReadDataFromChunks();
 
         bauhausBshFiles.try_emplace(zoom, std::move(bauhausBshFile));
     }
 
+    LoadTables();
+
+    MDCII_LOG_DEBUG("[OriginalResourcesManager::LoadFiles()] All files have been loaded successfully.");
+}
+
+void mdcii::resource::OriginalResourcesManager::LoadTables()
+{
     buildings = std::make_unique<const Buildings>(m_buildingsPath);
     figures = std::make_unique<const Figures>(m_figuresPath);
 
-    MDCII_LOG_DEBUG("[OriginalResourcesManager::LoadFiles()] All files have been loaded successfully.");
+    GfxTable::Create(*buildings);
+    AnimationClock::Create(*buildings, *figures);
 }
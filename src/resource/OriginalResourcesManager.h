@@ -23,6 +23,18 @@
 #include "Buildings.h"
 #include "world/Zoom.h"
 
+//-------------------------------------------------
+// Forward declarations
+//-------------------------------------------------
+
+namespace mdcii::job
+{
+    /**
+     * @brief Forward declaration class JobSystem.
+     */
+    class JobSystem;
+}
+
 namespace mdcii::resource
 {
     //-------------------------------------------------
@@ -76,7 +88,25 @@ namespace mdcii::resource
         // Ctors. / Dtor.
         //-------------------------------------------------
 
-        OriginalResourcesManager();
+        OriginalResourcesManager() = delete;
+
+        /**
+         * @brief Constructs a new OriginalResourcesManager object and loads the original data.
+         *
+         * @param t_jobSystem Pointer to the JobSystem used to decode the Bsh graphics.
+         */
+        explicit OriginalResourcesManager(job::JobSystem* t_jobSystem);
+
+        /**
+         * @brief Constructs a new OriginalResourcesManager object with the buildings and figures only.
+         *
+         * No palette and no Bsh graphics are loaded. If the Json files of the cod files are
+         * found in the resources folder, the original game is not required at all.
+         *
+         * @param t_buildingsPath The path to the haeuser.cod.
+         * @param t_figuresPath The path to the figuren.cod.
+         */
+        OriginalResourcesManager(std::filesystem::path t_buildingsPath, std::filesystem::path t_figuresPath);
 
         OriginalResourcesManager(const OriginalResourcesManager& t_other) = delete;
         OriginalResourcesManager(OriginalResourcesManager&& t_other) noexcept = delete;
@@ -107,6 +137,17 @@ namespace mdcii::resource
          */
         [[nodiscard]] const Figure& GetFigureById(FigureId t_figureId) const;
 
+        //-------------------------------------------------
+        // Bsh textures
+        //-------------------------------------------------
+
+        /**
+         * @brief Releases the least recently used bauhaus images that exceed the memory budget.
+         *
+         * Must be called at the beginning of a frame, before any image is requested.
+         */
+        void ReleaseUnusedBshTextures() const;
+
     protected:
 
     private:
@@ -196,7 +237,14 @@ namespace mdcii::resource
 
         /**
          * @brief Load original data from files.
+         *
+         * @param t_jobSystem Pointer to the JobSystem used to decode the Bsh graphics.
+         */
+        void LoadFiles(job::JobSystem* t_jobSystem);
+
+        /**
+         * @brief Load the buildings and figures and create the tables depending on them.
          */
-        void LoadFiles();
+        void LoadTables();
     };
 }
@@ -17,9 +17,9 @@
 // Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
 
 #include "PaletteFile.h"
+#include "Profiler.h"
 #include "MdciiAssert.h"
 #include "MdciiException.h"
-#include "chunk/Chunk.h"
 
 //-------------------------------------------------
 // Ctors. / Dtor.
@@ -30,7 +30,7 @@ mdcii::resource::PaletteFile::PaletteFile(std::string t_filePath)
 {
     MDCII_LOG_DEBUG("[PaletteFile::PaletteFile()] Create PaletteFile.");
 
-    if (chunks.at(0)->id.c_str() != CHUNK_ID) // NOLINT(*-redundant-string-cstr)
+    if (chunks.at(0).id != CHUNK_ID)
     {
         throw MDCII_EXCEPTION("[PaletteFile::PaletteFile()] Invalid Chunk Id.");
     }
@@ -47,15 +47,17 @@ mdcii::resource::PaletteFile::~PaletteFile() noexcept
 
 void mdcii::resource::PaletteFile::ReadDataFromChunks()
 {
+    MDCII_PROFILE_SCOPE("PaletteFile::ReadDataFromChunks");
+
     MDCII_LOG_DEBUG("[PaletteFile::ReadDataFromChunks()] Start reading Palette data from Chunks...");
 
     const auto& chunk0{ chunks.at(0) };
 
-    for (size_t i{ 0 }; i < chunk0->length; i += 4)
+    for (size_t i{ 0 }; i + 2 < chunk0.length; i += 4)
     {
-        const auto red{ chunk0->data.at(i) };
-        const auto green{ chunk0->data.at(i + 1) };
-        const auto blue{ chunk0->data.at(i + 2) };
+        const auto red{ chunk0.data[i] };
+        const auto green{ chunk0.data[i + 1] };
+        const auto blue{ chunk0.data[i + 2] };
 
         palette.emplace_back(red, green, blue);
     }
@@ -16,9 +16,12 @@
 // along with this program; if not, write to the Free Software
 // Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
 
+#include <algorithm>
 #include "TileAtlas.h"
+#include "GfxTable.h"
 #include "world/layer/Layer.h"
 #include "camera/Camera.h"
+#include "renderer/DrawList.h"
 
 //-------------------------------------------------
 // Ctors. / Dtor.
@@ -31,6 +34,8 @@ mdcii::resource::TileAtlas::TileAtlas(const world::World* t_world)
     MDCII_LOG_DEBUG("[TileAtlas::TileAtlas()] Create TileAtlas.");
 
     MDCII_ASSERT(m_world, "[TileAtlas::TileAtlas()] Null pointer.")
+
+    InitDrawInfos();
 }
 
 mdcii::resource::TileAtlas::~TileAtlas() noexcept
@@ -42,7 +47,8 @@ mdcii::resource::TileAtlas::~TileAtlas() noexcept
 // Logic
 //-------------------------------------------------
 
-void mdcii::resource::TileAtlas::RenderTile(
+int mdcii::resource::TileAtlas::RenderTile(
+    renderer::DrawList* t_drawList,
     const int t_startX,
     const int t_startY,
     const world::tile::TerrainTile* t_tile,
@@ -50,107 +56,187 @@ void mdcii::resource::TileAtlas::RenderTile(
 ) const
 {
     const auto zoomInt{ magic_enum::enum_integer(m_world->camera->zoom) };
-    const auto gfx{ GetGfxForCurrentRotation(t_tile) };
-    const olc::vf2d atlasOffset{ GetAtlasOffset(gfx, NR_OF_ROWS[zoomInt]) };
-
-    olc::vf2d screenPosition{ m_world->ToScreen(t_tile->posX + t_startX, t_tile->posY + t_startY) };
-    screenPosition.y -= CalcOffset(t_tile, gfx);
+    const auto [screenPosition, drawInfo]{ CalcTileDraw(t_tile->posX + t_startX, t_tile->posY + t_startY, t_tile) };
 
-    m_world->state->game->DrawPartialDecal(
+    return t_drawList->Add(
         screenPosition,
-        m_atlas[zoomInt][GetAtlasIndex(gfx, NR_OF_ROWS[zoomInt])]->Decal(),
-        {
-            atlasOffset.x * LARGEST_SIZE[zoomInt].second.first,
-            atlasOffset.y * LARGEST_SIZE[zoomInt].second.second
-        },
+        drawInfo->decal,
+        drawInfo->sourcePos,
         {
             LARGEST_SIZE[zoomInt].second.first,
             LARGEST_SIZE[zoomInt].second.second
         },
-        { 1.0f, 1.0f },
         t_tile->tintFlag == 1 ? olc::BLUE : t_tint
     );
 }
 
-void mdcii::resource::TileAtlas::CalcAnimationFrame(const float t_elapsedTime)
+void mdcii::resource::TileAtlas::UpdateTile(
+    const int t_drawIndex,
+    const int t_x,
+    const int t_y,
+    const world::tile::TerrainTile* t_tile
+) const
 {
-    for (auto& timer : m_timer_values)
-    {
-        timer += t_elapsedTime;
-    }
+    const auto [screenPosition, drawInfo]{ CalcTileDraw(t_x, t_y, t_tile) };
+    m_world->drawList->Update(t_drawIndex, screenPosition, drawInfo->decal, drawInfo->sourcePos);
+}
 
-    if (m_timer_values[0] >= 0.09f)
-    {
-        frame_values[0] = ++frame_values[0];
-        m_timer_values[0] = 0.0f;
-        frame_values[0] %= MAX_FRAME_VALUE + 1;
-    }
+void mdcii::resource::TileAtlas::RenderTileToSprite(
+    const TileDraw& t_draw,
+    olc::Sprite* t_target,
+    const olc::vi2d& t_targetOrigin,
+    const physics::Aabb& t_clip
+)
+{
+    MDCII_ASSERT(t_target, "[TileAtlas::RenderTileToSprite()] Null pointer.")
 
-    if (m_timer_values[1] >= 0.13f)
+    if (!t_draw.sprite)
     {
-        frame_values[1] = ++frame_values[1];
-        m_timer_values[1] = 0.0f;
-        frame_values[1] %= MAX_FRAME_VALUE + 1;
+        return;
     }
 
-    if (m_timer_values[2] >= 0.15f)
+    // the drawn area in the coordinates of the target
+    const olc::vi2d position{ t_draw.position };
+    const auto area{ physics::Aabb::Intersection(
+        physics::Aabb::Intersection({ position, t_draw.size }, t_clip),
+        { t_targetOrigin, t_target->Size() }
+    ) };
+    if (area.size.x <= 0 || area.size.y <= 0)
     {
-        frame_values[2] = ++frame_values[2];
-        m_timer_values[2] = 0.0f;
-        frame_values[2] %= MAX_FRAME_VALUE + 1;
+        return;
     }
 
-    if (m_timer_values[3] >= 0.18f)
-    {
-        frame_values[3] = ++frame_values[3];
-        m_timer_values[3] = 0.0f;
-        frame_values[3] %= MAX_FRAME_VALUE + 1;
-    }
+    const olc::vi2d target{ area.position - t_targetOrigin };
+    const olc::vi2d source{ olc::vi2d(t_draw.sourcePos) + area.position - position };
+    const auto tinted{ t_draw.tint != olc::WHITE };
 
-    if (m_timer_values[4] >= 0.22f)
+    for (auto y{ 0 }; y < area.size.y; ++y)
     {
-        frame_values[4] = ++frame_values[4];
-        m_timer_values[4] = 0.0f;
-        frame_values[4] %= MAX_FRAME_VALUE + 1;
+        const auto* sourceRow{ t_draw.sprite->pColData.data() + static_cast<size_t>(source.y + y) * t_draw.sprite->width + source.x };
+        auto* targetRow{ t_target->GetData() + static_cast<size_t>(target.y + y) * t_target->width + target.x };
+
+        auto x{ 0 };
+        while (x < area.size.x)
+        {
+            // most pixels are either transparent or opaque, so they are skipped or copied in runs
+            if (!tinted && sourceRow[x].a == 255)
+            {
+                auto end{ x + 1 };
+                while (end < area.size.x && sourceRow[end].a == 255)
+                {
+                    ++end;
+                }
+
+                std::copy(sourceRow + x, sourceRow + end, targetRow + x);
+                x = end;
+
+                continue;
+            }
+
+            auto pixel{ sourceRow[x] };
+            if (pixel.a != 0)
+            {
+                pixel *= t_draw.tint;
+                targetRow[x] = pixel.a == 255 ? pixel : olc::PixelLerp(targetRow[x], pixel, static_cast<float>(pixel.a) / 255.0f);
+            }
+
+            ++x;
+        }
     }
 }
 
+mdcii::resource::TileAtlas::TileDraw mdcii::resource::TileAtlas::GetTileDraw(
+    const int t_startX,
+    const int t_startY,
+    const world::tile::TerrainTile* t_tile
+) const
+{
+    const auto zoomInt{ magic_enum::enum_integer(m_world->camera->zoom) };
+    const auto [screenPosition, drawInfo]{ CalcTileDraw(t_tile->posX + t_startX, t_tile->posY + t_startY, t_tile) };
+
+    return {
+        drawInfo->decal,
+        drawInfo->sprite,
+        screenPosition,
+        drawInfo->sourcePos,
+        { LARGEST_SIZE[zoomInt].second.first, std::min(drawInfo->height, LARGEST_SIZE[zoomInt].second.second) },
+        t_tile->tintFlag == 1 ? olc::BLUE : olc::WHITE
+    };
+}
+
+std::pair<olc::vf2d, olc::vf2d> mdcii::resource::TileAtlas::CalcCellScreenArea(const int t_x, const int t_y) const
+{
+    const auto zoom{ m_world->camera->zoom };
+    const auto zoomInt{ magic_enum::enum_integer(zoom) };
+    const auto tileHeight{ static_cast<float>(zoom == world::Zoom::GFX ? 31 : get_tile_height(zoom)) };
+    const auto height{ std::max(LARGEST_SIZE[zoomInt].second.second, tileHeight) + world::ELEVATIONS[zoomInt] };
+
+    // the bottom of a gfx is never below the bottom of the tile
+    olc::vf2d position{ m_world->ToScreen(t_x, t_y) };
+    position.y += tileHeight - height;
+
+    return { position, { LARGEST_SIZE[zoomInt].second.first, height } };
+}
+
 //-------------------------------------------------
 // Helper
 //-------------------------------------------------
 
-int mdcii::resource::TileAtlas::GetGfxForCurrentRotation(const world::tile::TerrainTile* t_tile) const
+void mdcii::resource::TileAtlas::InitDrawInfos()
 {
-    MDCII_ASSERT(!t_tile->gfxs.empty(), "[TileAtlas::GetGfxForCurrentRotation()] Missing gfx values.")
+    MDCII_LOG_DEBUG("[TileAtlas::InitDrawInfos()] Precalculate the draw info of each gfx.");
 
-    if (t_tile->gfxs.size() == 1)
+    for (const auto zoom : magic_enum::enum_values<world::Zoom>())
     {
-        return t_tile->gfxs[0] + t_tile->frame * t_tile->building->animAdd;
-    }
+        const auto zoomInt{ magic_enum::enum_integer(zoom) };
+        const auto rows{ NR_OF_ROWS[zoomInt] };
+        const auto tileHeight{ zoom == world::Zoom::GFX ? 31 : get_tile_height(zoom) };
 
-    const auto worldRotation{ m_world->camera->rotation + world::int_to_rotation(t_tile->rotation) };
-    return t_tile->gfxs[magic_enum::enum_integer(worldRotation)] + t_tile->frame * t_tile->building->animAdd;
+        m_drawInfos[zoomInt].resize(m_heights[zoomInt].size());
+        for (auto gfx{ 0 }; gfx < static_cast<int>(m_heights[zoomInt].size()); ++gfx)
+        {
+            const auto atlasIndex{ GetAtlasIndex(gfx, rows) };
+            const olc::vf2d atlasOffset{ GetAtlasOffset(gfx, rows) };
+            const auto gfxHeight{ m_heights[zoomInt][gfx] };
+
+            auto& drawInfo{ m_drawInfos[zoomInt][gfx] };
+            if (atlasIndex < static_cast<int>(m_atlas[zoomInt].size()))
+            {
+                drawInfo.decal = m_atlas[zoomInt][atlasIndex]->Decal();
+                drawInfo.sprite = m_atlas[zoomInt][atlasIndex]->Sprite();
+            }
+            drawInfo.sourcePos = { atlasOffset.x * LARGEST_SIZE[zoomInt].second.first, atlasOffset.y * LARGEST_SIZE[zoomInt].second.second };
+            drawInfo.offset = gfxHeight > tileHeight ? static_cast<float>(gfxHeight - tileHeight) : 0.0f;
+            drawInfo.height = static_cast<float>(gfxHeight);
+        }
+    }
 }
 
-float mdcii::resource::TileAtlas::CalcOffset(const world::tile::TerrainTile* t_tile, const int t_gfx) const
+std::pair<olc::vf2d, const mdcii::resource::TileAtlas::GfxDrawInfo*> mdcii::resource::TileAtlas::CalcTileDraw(
+    const int t_x,
+    const int t_y,
+    const world::tile::TerrainTile* t_tile
+) const
 {
-    auto offset{ 0.0f };
     const auto zoomInt{ magic_enum::enum_integer(m_world->camera->zoom) };
-    auto tileHeight{ get_tile_height(m_world->camera->zoom) };
-    const auto gfxHeight{ m_heights[zoomInt][t_gfx] };
+    const auto& tileGfx{ GfxTable::Get(t_tile->gfxIndex) };
+    const auto& drawInfo{ m_drawInfos[zoomInt][GetGfxForCurrentRotation(t_tile, tileGfx)] };
 
-    if (m_world->camera->zoom == world::Zoom::GFX)
-    {
-        tileHeight = 31;
-    }
-    if (gfxHeight > tileHeight)
-    {
-        offset = static_cast<float>(gfxHeight) - static_cast<float>(tileHeight);
-    }
-    if (t_tile->HasBuildingAboveWaterAndCoast())
+    olc::vf2d screenPosition{ m_world->ToScreen(t_x, t_y) };
+    screenPosition.y -= tileGfx.elevated ? drawInfo.offset + world::ELEVATIONS[zoomInt] : drawInfo.offset;
+
+    return { screenPosition, &drawInfo };
+}
+
+int mdcii::resource::TileAtlas::GetGfxForCurrentRotation(const world::tile::TerrainTile* t_tile, const TileGfx& t_tileGfx) const
+{
+    MDCII_ASSERT(t_tileGfx.nrOfGfxs > 0, "[TileAtlas::GetGfxForCurrentRotation()] Missing gfx values.")
+
+    if (t_tileGfx.nrOfGfxs == 1)
     {
-        offset += world::ELEVATIONS[zoomInt];
+        return t_tileGfx.gfxs[0] + t_tile->frame * t_tileGfx.animAdd;
     }
 
-    return offset;
+    const auto worldRotation{ m_world->camera->rotation + world::int_to_rotation(t_tile->rotation) };
+    return t_tileGfx.gfxs[magic_enum::enum_integer(worldRotation)] + t_tile->frame * t_tileGfx.animAdd;
 }
@@ -19,6 +19,7 @@
 #pragma once
 
 #include "BshTileAtlas.h"
+#include "physics/Aabb.h"
 
 //-------------------------------------------------
 // Forward declarations
@@ -40,8 +41,25 @@ namespace mdcii::world::tile
     struct TerrainTile;
 }
 
+namespace mdcii::renderer
+{
+    /**
+     * @brief Forward declaration class DrawList.
+     */
+    class DrawList;
+}
+
 namespace mdcii::resource
 {
+    //-------------------------------------------------
+    // Forward declarations
+    //-------------------------------------------------
+
+    /**
+     * @brief Forward declaration struct TileGfx.
+     */
+    struct TileGfx;
+
     //-------------------------------------------------
     // TileAtlas
     //-------------------------------------------------
@@ -53,13 +71,44 @@ namespace mdcii::resource
     {
     public:
         //-------------------------------------------------
-        // Member
+        // Types
         //-------------------------------------------------
 
         /**
-         * @brief When one of the five timers expires, the respective frame is counted up.
+         * @brief The atlas region of a tile and where it is drawn on the screen.
          */
-        inline static std::array frame_values{ 0, 0, 0, 0, 0 };
+        struct TileDraw
+        {
+            /**
+             * @brief The decal of the atlas image; nullptr if the gfx is missing.
+             */
+            olc::Decal* decal{ nullptr };
+
+            /**
+             * @brief The sprite of the atlas image; nullptr if the gfx is missing.
+             */
+            const olc::Sprite* sprite{ nullptr };
+
+            /**
+             * @brief The screen position of the top left corner.
+             */
+            olc::vf2d position;
+
+            /**
+             * @brief The top left position of the region in the atlas image.
+             */
+            olc::vf2d sourcePos;
+
+            /**
+             * @brief The size of the gfx, which is the screen area covered by the tile.
+             */
+            olc::vf2d size;
+
+            /**
+             * @brief The color tint.
+             */
+            olc::Pixel tint{ olc::WHITE };
+        };
 
         //-------------------------------------------------
         // Ctors. / Dtor.
@@ -85,8 +134,61 @@ namespace mdcii::resource
         // Logic
         //-------------------------------------------------
 
-        void RenderTile(int t_startX, int t_startY, const world::tile::TerrainTile* t_tile, const olc::Pixel& t_tint) const;
-        static void CalcAnimationFrame(float t_elapsedTime);
+        /**
+         * @brief Adds a tile to a DrawList.
+         *
+         * @param t_drawList The DrawList to add to.
+         * @param t_startX The x offset.
+         * @param t_startY The y offset.
+         * @param t_tile Pointer to the tile.
+         * @param t_tint Color tint.
+         *
+         * @return The index of the draw in the DrawList.
+         */
+        int RenderTile(renderer::DrawList* t_drawList, int t_startX, int t_startY, const world::tile::TerrainTile* t_tile, const olc::Pixel& t_tint) const;
+
+        /**
+         * @brief Sets a retained draw of the DrawList to the current frame of a tile.
+         *
+         * @param t_drawIndex The index of the draw in the DrawList.
+         * @param t_x The x position of the tile in the world.
+         * @param t_y The y position of the tile in the world.
+         * @param t_tile Pointer to the tile.
+         */
+        void UpdateTile(int t_drawIndex, int t_x, int t_y, const world::tile::TerrainTile* t_tile) const;
+
+        /**
+         * @brief Draws a tile into a sprite instead of the screen.
+         *
+         * Only reads the atlas sprite, so it can be called on any thread.
+         *
+         * @param t_draw Where and what to draw.
+         * @param t_target The sprite to draw into.
+         * @param t_targetOrigin The position of the top left corner of the sprite.
+         * @param t_clip Only the pixels in this area are drawn.
+         */
+        static void RenderTileToSprite(const TileDraw& t_draw, olc::Sprite* t_target, const olc::vi2d& t_targetOrigin, const physics::Aabb& t_clip);
+
+        /**
+         * @brief Calculates where a tile is drawn and the screen area covered by its gfx.
+         *
+         * @param t_startX The x offset.
+         * @param t_startY The y offset.
+         * @param t_tile Pointer to the tile.
+         *
+         * @return The TileDraw object.
+         */
+        [[nodiscard]] TileDraw GetTileDraw(int t_startX, int t_startY, const world::tile::TerrainTile* t_tile) const;
+
+        /**
+         * @brief Calculates the screen area that any gfx of a world position can cover, including the elevation.
+         *
+         * @param t_x The world x position.
+         * @param t_y The world y position.
+         *
+         * @return The top left corner and the size.
+         */
+        [[nodiscard]] std::pair<olc::vf2d, olc::vf2d> CalcCellScreenArea(int t_x, int t_y) const;
 
     protected:
 
@@ -129,11 +231,6 @@ namespace mdcii::resource
          */
         static constexpr std::string_view TILE_ATLAS_NAME{ "stadtfld" };
 
-        /**
-         * @brief To avoid m_frame_values[] will exceed that value.
-         */
-        static constexpr int MAX_FRAME_VALUE{ 1000 };
-
         //-------------------------------------------------
         // Member
         //-------------------------------------------------
@@ -144,18 +241,28 @@ namespace mdcii::resource
         const world::World* m_world{ nullptr };
 
         /**
-         * @brief Five timers to measure the times for the next frame.
-         *
-         * The animation speeds of the buildings are finally defined.
-         * So after 90, 130, 150, 180, 220 milliseconds the next frame from the animation is used.
+         * @brief The atlas image, the source position in it and the height offset of a gfx.
+         */
+        struct GfxDrawInfo
+        {
+            olc::Decal* decal{ nullptr };
+            olc::Sprite* sprite{ nullptr };
+            olc::vf2d sourcePos;
+            float offset{ 0.0f };
+            float height{ 0.0f };
+        };
+
+        /**
+         * @brief The precalculated draw info of each gfx for each zoom.
          */
-        inline static std::array m_timer_values{ 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+        std::array<std::vector<GfxDrawInfo>, world::NR_OF_ZOOMS> m_drawInfos;
 
         //-------------------------------------------------
         // Helper
         //-------------------------------------------------
 
-        [[nodiscard]] int GetGfxForCurrentRotation(const world::tile::TerrainTile* t_tile) const;
-        [[nodiscard]] float CalcOffset(const world::tile::TerrainTile* t_tile, int t_gfx) const;
+        void InitDrawInfos();
+        [[nodiscard]] std::pair<olc::vf2d, const GfxDrawInfo*> CalcTileDraw(int t_x, int t_y, const world::tile::TerrainTile* t_tile) const;
+        [[nodiscard]] int GetGfxForCurrentRotation(const world::tile::TerrainTile* t_tile, const TileGfx& t_tileGfx) const;
     };
 }
@@ -17,6 +17,8 @@
 // Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
 
 #include "DeepWater.h"
+#include "state/State.h"
+#include "resource/OriginalResourcesManager.h"
 
 //-------------------------------------------------
 // Ctors. / Dtor.
@@ -38,89 +40,43 @@ mdcii::world::DeepWater::~DeepWater() noexcept
 }
 
 //-------------------------------------------------
-// Init
+// Logic
 //-------------------------------------------------
 
-void mdcii::world::DeepWater::Init()
+bool mdcii::world::DeepWater::UpdateCurrentSpans()
 {
-    MDCII_LOG_DEBUG("[DeepWater::Init()] Start creating the deep water area ...");
-
-    InitLayer();
-    SetWorldPositions();
-    RemoveIrrelevantTiles();
-    UpdateTileProperties();
+    currentSpans.clear();
+    m_world->viewport->CalcVisibleSpans(0, 0, m_world->worldWidth, m_world->worldHeight, 0, currentSpans);
 
-    MDCII_LOG_DEBUG("[DeepWater::Init()] The deep water area was successfully created.");
+    return !currentSpans.empty();
 }
 
-void mdcii::world::DeepWater::InitLayer()
+void mdcii::world::DeepWater::UpdateAnimation()
 {
-    MDCII_LOG_DEBUG("[DeepWater::InitLayer()] Init deep water layer.");
-
-    layer = std::make_unique<layer::TerrainLayer<tile::TerrainTile>>(m_world, layer::LayerType::DEEP_WATER, m_world->worldWidth, m_world->worldHeight);
-    layer->tiles.resize(m_world->worldWidth * m_world->worldHeight);
-
-    for (auto y{ 0 }; y < m_world->worldHeight; ++y)
+    if (m_clock != resource::AnimationClock::NO_CLOCK)
     {
-        for (auto x{ 0 }; x < m_world->worldWidth; ++x)
-        {
-            if (!m_world->IsWorldPositionOverAnyIsland(x, y))
-            {
-                const auto& building1201{ m_world->state->game->originalResourcesManager->GetBuildingById(resource::DEEP_WATER_BUILDING_ID) };
-                layer->tiles.at(y * m_world->worldWidth + x).building = &building1201;
-            }
-        }
+        // all deep water positions share the same animation frame
+        tile.frame = static_cast<uint8_t>(resource::AnimationClock::GetFrame(m_clock, tile.building->animAnz));
     }
 }
 
-void mdcii::world::DeepWater::SetWorldPositions()
-{
-    MDCII_LOG_DEBUG("[DeepWater::SetWorldPositions()] Set a world position for each tile.");
-
-    for (auto h{ 0 }; h < m_world->worldHeight; ++h)
-    {
-        for (auto w{ 0 }; w < m_world->worldWidth; ++w)
-        {
-            auto& tile{ layer->tiles.at(h * m_world->worldWidth + w) };
-            tile.posX = w;
-            tile.posY = h;
-        }
-    }
-}
+//-------------------------------------------------
+// Init
+//-------------------------------------------------
 
-void mdcii::world::DeepWater::RemoveIrrelevantTiles() const
+void mdcii::world::DeepWater::Init()
 {
-    MDCII_LOG_DEBUG("[DeepWater::RemoveIrrelevantTiles()] Remove tiles without building info.");
-
-    auto [begin, end]{ std::ranges::remove_if(layer->tiles, [](const auto& t_tile)
-    {
-        return t_tile.building == nullptr; })
-    };
+    MDCII_LOG_DEBUG("[DeepWater::Init()] Start creating the deep water area ...");
 
-    layer->tiles.erase(begin, end);
-}
+    tile.building = &m_world->state->game->originalResourcesManager->GetBuildingById(resource::DEEP_WATER_BUILDING_ID);
 
-void mdcii::world::DeepWater::UpdateTileProperties() const
-{
-    MDCII_LOG_DEBUG("[DeepWater::UpdateTileProperties()] Pre-calculate other properties.");
+    // pre-calculate a gfx for each rotation
+    tile.CalculateGfxValues();
 
-    for (auto& tile : layer->tiles)
+    if (tile.building->animAnz > 1)
     {
-        MDCII_ASSERT(tile.HasBuilding(), "[DeepWater::UpdateTileProperties()] Building information is missing.")
-
-        // pre-calculate a gfx for each rotation
-        const auto gfx0{ tile.building->gfx };
-
-        tile.gfxs.push_back(gfx0);
-        if (tile.building->IsRotatable())
-        {
-            tile.gfxs.push_back(gfx0 + (1 * tile.building->rotate));
-            tile.gfxs.push_back(gfx0 + (2 * tile.building->rotate));
-            tile.gfxs.push_back(gfx0 + (3 * tile.building->rotate));
-        }
-
-        tile.CalcRenderPositions(layer->width, layer->height);
+        m_clock = resource::AnimationClock::GetClock(tile.building->animTime);
     }
 
-    layer->SortTilesForRendering();
+    MDCII_LOG_DEBUG("[DeepWater::Init()] The deep water area was successfully created.");
 }
@@ -18,11 +18,15 @@
 
 #pragma once
 
-#include "world/layer/Layer.h"
-
-//-------------------------------------------------
-// Forward declarations
-//-------------------------------------------------
+#include "MdciiAssert.h"
+#include "Game.h"
+#include "world/tile/TerrainTile.h"
+#include "resource/AnimationClock.h"
+#include "world/RenderOrder.h"
+#include "world/Viewport.h"
+#include "world/OccupancyGrid.h"
+#include "world/World.h"
+#include "camera/Camera.h"
 
 namespace mdcii::world
 {
@@ -32,6 +36,10 @@ namespace mdcii::world
 
     /**
      * @brief Represents the deep water area.
+     *
+     * All positions without an island are deep water and use the same building.
+     * Therefore no tiles are stored. A single tile is moved over the visible positions
+     * while rendering.
      */
     class DeepWater
     {
@@ -41,9 +49,14 @@ namespace mdcii::world
         //-------------------------------------------------
 
         /**
-         * @brief The deep water area tile layer.
+         * @brief The tile used to render each deep water position.
+         */
+        tile::TerrainTile tile;
+
+        /**
+         * @brief The visible positions of the world in the render order of the current rotation.
          */
-        std::unique_ptr<layer::TerrainLayer<tile::TerrainTile>> layer;
+        std::vector<TileSpan> currentSpans;
 
         //-------------------------------------------------
         // Ctors. / Dtor.
@@ -65,45 +78,76 @@ namespace mdcii::world
 
         ~DeepWater() noexcept;
 
-    protected:
-
-    private:
         //-------------------------------------------------
-        // Member
+        // Logic
         //-------------------------------------------------
 
         /**
-         * @brief Pointer to the parent World object.
+         * @brief Updates the visible positions.
+         *
+         * @return True if there are visible positions; otherwise false.
          */
-        World* m_world{ nullptr };
-
-        //-------------------------------------------------
-        // Init
-        //-------------------------------------------------
+        bool UpdateCurrentSpans();
 
         /**
-         * @brief Initializes the deep water area.
+         * @brief Sets the current animation frame of the tile shared by all positions.
          */
-        void Init();
+        void UpdateAnimation();
 
         /**
-         * @brief Initialize the deep water layer and its tiles.
+         * @brief Calls a function for each visible deep water position in render order.
+         *
+         * The tile passed to the function is moved to the position before each call.
+         *
+         * @param t_func The function to call with a reference to the tile.
          */
-        void InitLayer();
+        template <typename F>
+        void ForEachCurrentTile(F&& t_func)
+        {
+            const auto rotation{ m_world->camera->rotation };
+
+            for (const auto& [chunk, begin, end] : currentSpans)
+            {
+                for (auto k{ begin }; k < end; ++k)
+                {
+                    const auto position{ get_map_position(k, m_world->worldWidth, m_world->worldHeight, rotation) };
+                    if (m_world->islandGrid->GetIslandIndex(position.x, position.y) != OccupancyGrid::NO_ISLAND)
+                    {
+                        continue;
+                    }
+
+                    tile.posX = position.x;
+                    tile.posY = position.y;
+
+                    t_func(tile);
+                }
+            }
+        }
+
+    protected:
+
+    private:
+        //-------------------------------------------------
+        // Member
+        //-------------------------------------------------
 
         /**
-         * @brief Set the world positions for each tile.
+         * @brief Pointer to the parent World object.
          */
-        void SetWorldPositions();
+        World* m_world{ nullptr };
 
         /**
-         * @brief Remove tiles that do not belong to the deep water.
+         * @brief The animation clock of the deep water building.
          */
-        void RemoveIrrelevantTiles() const;
+        int m_clock{ resource::AnimationClock::NO_CLOCK };
+
+        //-------------------------------------------------
+        // Init
+        //-------------------------------------------------
 
         /**
-         * @brief Update the properties of each tile based on the buildingId it contains.
+         * @brief Initializes the deep water tile.
          */
-        void UpdateTileProperties() const;
+        void Init();
     };
 }
@@ -160,10 +160,28 @@ void mdcii::world::Gui::RenderBuildingsByTitleGui(
 )
 {
     const auto zoomOpt{ magic_enum::enum_cast<Zoom>(Game::INI.Get<std::string>("menu", "bauhaus_zoom")) };
-    const auto& bshTextures{ t_game->originalResourcesManager->bauhausBshFiles[zoomOpt.value_or(Zoom::GFX)]->bshTextures };
+    auto* bauhausBshFile{ t_game->originalResourcesManager->bauhausBshFiles[zoomOpt.value_or(Zoom::GFX)].get() };
+
+    const auto getBaugfx{ [](const resource::Building& t_building) {
+        auto baugfx{ t_building.baugfx };
+        if (t_building.IsRotatable() && t_building.IsNotRoad())
+        {
+            baugfx += magic_enum::enum_integer(select_building.rotation);
+        }
+
+        return baugfx;
+    } };
 
     if (ImGui::TreeNode(_(t_title.c_str())))
     {
+        // the images of the group are decoded together
+        std::vector<int> baugfxs;
+        for (const auto buildingId : t_buildingIds)
+        {
+            baugfxs.push_back(getBaugfx(t_game->originalResourcesManager->GetBuildingById(buildingId)));
+        }
+        bauhausBshFile->Prefetch(baugfxs);
+
         auto i{ 0 };
         for (const auto buildingId : t_buildingIds)
         {
@@ -171,13 +189,7 @@ void mdcii::world::Gui::RenderBuildingsByTitleGui(
             {
                 const auto& building{ t_game->originalResourcesManager->GetBuildingById(buildingId) };
 
-                auto baugfx{ building.baugfx };
-                if (building.IsRotatable() && building.IsNotRoad())
-                {
-                    baugfx += magic_enum::enum_integer(select_building.rotation);
-                }
-
-                if (const auto& renderableBauhaus{ bshTextures.at(baugfx)->decal };
+                if (const auto& renderableBauhaus{ bauhausBshFile->GetTexture(getBaugfx(building))->decal };
                     ImGui::ImageButton(
                         reinterpret_cast<ImTextureID>(static_cast<uintptr_t>(renderableBauhaus->id)),  // texture-Id
                         ImVec2(static_cast<float>(renderableBauhaus->sprite->width), static_cast<float>(renderableBauhaus->sprite->height)), // size
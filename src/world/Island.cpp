@@ -20,6 +20,7 @@
 #include "MousePicker.h"
 #include "MdciiUtils.h"
 #include "renderer/Renderer.h"
+#include "renderer/DrawList.h"
 #include "resource/AssetManager.h"
 #include "resource/TileAtlas.h"
 
@@ -39,7 +40,10 @@ mdcii::world::Island::Island(const World* t_world, const nlohmann::json& t_json)
     SetLayerData(t_json);
 
     InitLayerData();
-    InitMixedLayerData();
+    InitMixedLayer();
+
+    m_imposter = std::make_unique<IslandImposter>(this);
+    m_drawList = std::make_unique<renderer::DrawList>();
 }
 
 mdcii::world::Island::~Island() noexcept
@@ -77,6 +81,16 @@ const mdcii::world::layer::FiguresLayer<mdcii::world::tile::FigureTile>* mdcii::
     return m_figuresLayer.get();
 }
 
+mdcii::world::layer::MixedLayer* mdcii::world::Island::GetMixedLayer()
+{
+    return m_mixedLayer.get();
+}
+
+const mdcii::world::layer::MixedLayer* mdcii::world::Island::GetMixedLayer() const
+{
+    return m_mixedLayer.get();
+}
+
 //-------------------------------------------------
 // Position
 //-------------------------------------------------
@@ -99,6 +113,74 @@ std::optional<olc::vi2d> mdcii::world::Island::IsMouseOverIsland() const
     return std::nullopt;
 }
 
+void mdcii::world::Island::SetPosition(const int t_x, const int t_y)
+{
+    if (startX == t_x && startY == t_y)
+    {
+        return;
+    }
+
+    startX = t_x;
+    startY = t_y;
+    m_moved = true;
+
+    m_aabb = physics::Aabb(olc::vi2d(startX, startY), olc::vi2d(width, height));
+}
+
+//-------------------------------------------------
+// Changes
+//-------------------------------------------------
+
+bool mdcii::world::Island::HasChanges() const
+{
+    return m_moved ||
+           !m_figuresLayer->dirtyChunks.empty() ||
+           std::ranges::any_of(m_terrainLayers, [](const auto& t_entry) { return !t_entry.second->dirtyChunks.empty(); });
+}
+
+bool mdcii::world::Island::HasVisibleChanges() const
+{
+    // the chunks of all layers have the same layout, so the spans of the mixed layer fit each layer
+    const auto visible{ [this](const auto& t_layer)
+    {
+        return t_layer->HasVisibleDirtyChunks(m_mixedLayer->currentSpans) || t_layer->HasVisibleDirtyChunks(t_layer->currentSpans);
+    } };
+
+    return visible(m_figuresLayer) ||
+           std::ranges::any_of(m_terrainLayers, [&visible](const auto& t_entry) { return visible(t_entry.second); });
+}
+
+void mdcii::world::Island::ClearChanges()
+{
+    // the overlays of the cached images depend on the positions of the figures
+    if (!m_figuresLayer->dirtyChunks.empty())
+    {
+        m_imposter->InvalidateOverlays();
+    }
+
+    for (const auto& [layerType, layer] : m_terrainLayers)
+    {
+        layer->ClearDirtyChunks();
+    }
+
+    m_figuresLayer->ClearDirtyChunks();
+    m_moved = false;
+}
+
+//-------------------------------------------------
+// Animations
+//-------------------------------------------------
+
+void mdcii::world::Island::UpdateAnimations()
+{
+    for (const auto& [layerType, layer] : m_terrainLayers)
+    {
+        layer->UpdateAnimations();
+    }
+
+    m_figuresLayer->UpdateAnimations();
+}
+
 //-------------------------------------------------
 // Add building
 //-------------------------------------------------
@@ -128,8 +210,8 @@ bool mdcii::world::Island::CreateNewBuildingTiles(
 
             if (IsWorldPositionOverIsland({ startX + posX, startY + posY }))
             {
-                const auto &terrainTileToCheck{ GetTerrainLayer(layer::LayerType::TERRAIN)->GetSortedTile(posX, posY, world->camera->rotation) };
-                const auto &buildingTileToCheck{ GetTerrainLayer(layer::LayerType::BUILDINGS)->GetSortedTile(posX, posY, world->camera->rotation) };
+                const auto &terrainTileToCheck{ GetTerrainLayer(layer::LayerType::TERRAIN)->GetTile(posX, posY) };
+                const auto &buildingTileToCheck{ GetTerrainLayer(layer::LayerType::BUILDINGS)->GetTile(posX, posY) };
 
                 if (terrainTileToCheck.HasBuildingAboveWaterAndCoast() && !buildingTileToCheck.HasBuilding())
                 {
@@ -173,8 +255,8 @@ void mdcii::world::Island::PreviewNewBuildingTiles() const
 
     for (const auto& tile : m_newBuildingTiles.value())
     {
-        world->tileAtlas->RenderTile(startX, startY, &tile, olc::DARK_GREY);
-        renderer::Renderer::RenderAsset(resource::Asset::GREEN_ISO, startX, startY, world, &tile, true);
+        world->tileAtlas->RenderTile(world->drawList.get(), startX, startY, &tile, olc::DARK_GREY);
+        renderer::Renderer::RenderAsset(world->drawList.get(), resource::Asset::GREEN_ISO, startX, startY, world, &tile, true);
     }
 }
 
@@ -188,10 +270,18 @@ void mdcii::world::Island::AddNewBuildingTiles()
     using enum layer::LayerType;
 
     GetTerrainLayer(BUILDINGS)->AddTiles(m_newBuildingTiles.value());
-    GetTerrainLayer(MIXED)->AddTiles(m_newBuildingTiles.value());
 
-    GetTerrainLayer(BUILDINGS)->UpdateCurrentTiles(startX, startY);
-    GetTerrainLayer(MIXED)->UpdateCurrentTiles(startX, startY);
+    // the mixed layer only refers to the new tiles
+    for (const auto& tile : m_newBuildingTiles.value())
+    {
+        m_mixedLayer->UpdateSource(tile.posX, tile.posY);
+    }
+
+    // the cached images no longer show all static tiles
+    m_imposter->InvalidateTiles(m_newBuildingTiles.value());
+
+    // the visible ranges only depend on the position of the tiles, so they remain valid;
+    // the changed chunks are recorded by the layers
 }
 
 //-------------------------------------------------
@@ -257,9 +347,6 @@ void mdcii::world::Island::SetLayerData(const nlohmann::json& t_json)
             }
         }
     }
-
-    // this mixed layer will later be filled with the data from the other layers
-    m_terrainLayers.emplace(MIXED, std::make_unique<layer::TerrainLayer<tile::TerrainTile>>(world, MIXED, width, height));
 }
 
 void mdcii::world::Island::SetLayerDataByType(const nlohmann::json& t_json, const layer::LayerType t_layerType)
@@ -305,47 +392,13 @@ void mdcii::world::Island::InitLayerData()
     m_figuresLayer->InitTiles();
 }
 
-void mdcii::world::Island::InitMixedLayerData()
-{
-    MDCII_LOG_DEBUG("[Island::InitMixedLayerData()] Initializing the MIXED layer tile data.");
-
-    using enum layer::LayerType;
-
-    GetTerrainLayer(MIXED)->tiles = GetTerrainLayer(BUILDINGS)->tiles;
-
-    for (auto h{ 0 }; h < height; ++h)
-    {
-        for (auto w{ 0 }; w < width; ++w)
-        {
-            PopulateMixedLayer(w, h);
-        }
-    }
-
-    GetTerrainLayer(MIXED)->SortTilesForRendering();
-}
-
-void mdcii::world::Island::PopulateMixedLayer(const int t_x, const int t_y)
+void mdcii::world::Island::InitMixedLayer()
 {
-    const auto index{ t_y * width + t_x };
-
-    MDCII_ASSERT(index >= 0 && index < width * height, "[Island::PopulateMixedLayer()] Invalid index.")
+    MDCII_LOG_DEBUG("[Island::InitMixedLayer()] Initializing the MIXED layer.");
 
     using enum layer::LayerType;
 
-    if (ShouldReplaceTile(GetTerrainLayer(COAST), index))
-    {
-        GetTerrainLayer(MIXED)->tiles.at(index) = GetTerrainLayer(COAST)->tiles.at(index);
-    }
-
-    if (ShouldReplaceTile(GetTerrainLayer(TERRAIN), index))
-    {
-        GetTerrainLayer(MIXED)->tiles.at(index) = GetTerrainLayer(TERRAIN)->tiles.at(index);
-    }
-}
-
-bool mdcii::world::Island::ShouldReplaceTile(const layer::TerrainLayer<tile::TerrainTile>* t_layer, const int t_index)
-{
-    return t_layer->tiles.at(t_index).HasBuilding() && !GetTerrainLayer(layer::LayerType::BUILDINGS)->tiles.at(t_index).HasBuilding();
+    m_mixedLayer = std::make_unique<layer::MixedLayer>(GetTerrainLayer(COAST), GetTerrainLayer(TERRAIN), GetTerrainLayer(BUILDINGS));
 }
 
 //-------------------------------------------------
@@ -365,16 +418,16 @@ void mdcii::world::to_json(nlohmann::json& t_json, const Island& t_island)
     t_json["layers"] = nlohmann::json::array();
 
     auto c = nlohmann::json::object();
-    c["coast"] = t_island.GetTerrainLayer(COAST)->tiles;
+    c["coast"] = t_island.GetTerrainLayer(COAST)->TilesToJson();
 
     auto t = nlohmann::json::object();
-    t["terrain"] = t_island.GetTerrainLayer(TERRAIN)->tiles;
+    t["terrain"] = t_island.GetTerrainLayer(TERRAIN)->TilesToJson();
 
     auto b = nlohmann::json::object();
-    b["buildings"] = t_island.GetTerrainLayer(BUILDINGS)->tiles;
+    b["buildings"] = t_island.GetTerrainLayer(BUILDINGS)->TilesToJson();
 
     auto f = nlohmann::json::object();
-    f["figures"] = t_island.GetFiguresLayer()->tiles;
+    f["figures"] = t_island.GetFiguresLayer()->TilesToJson();
 
     t_json["layers"].push_back(c);
     t_json["layers"].push_back(t);
@@ -19,7 +19,20 @@
 #pragma once
 
 #include "physics/Aabb.h"
-#include "world/layer/Layer.h"
+#include "world/layer/MixedLayer.h"
+#include "world/IslandImposter.h"
+
+//-------------------------------------------------
+// Forward declarations
+//-------------------------------------------------
+
+namespace mdcii::renderer
+{
+    /**
+     * @brief Forward declaration class DrawList.
+     */
+    class DrawList;
+}
 
 namespace mdcii::world
 {
@@ -152,6 +165,34 @@ namespace mdcii::world
          */
         [[nodiscard]] const layer::FiguresLayer<tile::FigureTile>* GetFiguresLayer() const;
 
+        /**
+         * @brief Getter function to retrieve a pointer to the mixed layer.
+         *
+         * @return A pointer to the view combining the COAST, TERRAIN and BUILDINGS layer.
+         */
+        [[nodiscard]] layer::MixedLayer* GetMixedLayer();
+
+        /**
+         * @brief Const getter function to retrieve a constant pointer to the mixed layer.
+         *
+         * @return A constant pointer to the view combining the COAST, TERRAIN and BUILDINGS layer.
+         */
+        [[nodiscard]] const layer::MixedLayer* GetMixedLayer() const;
+
+        /**
+         * @brief Getter function to retrieve a pointer to the cached image of the static tiles.
+         *
+         * @return A pointer to the IslandImposter object.
+         */
+        [[nodiscard]] IslandImposter* GetImposter() const { return m_imposter.get(); }
+
+        /**
+         * @brief Getter function to retrieve a pointer to the DrawList recording the draws of the island.
+         *
+         * @return A pointer to the DrawList object.
+         */
+        [[nodiscard]] renderer::DrawList* GetDrawList() const { return m_drawList.get(); }
+
         //-------------------------------------------------
         // Position
         //-------------------------------------------------
@@ -172,6 +213,55 @@ namespace mdcii::world
          */
         [[nodiscard]] std::optional<olc::vi2d> IsMouseOverIsland() const;
 
+        /**
+         * @brief Moves the island to another world position.
+         *
+         * @param t_x The new x position of the island.
+         * @param t_y The new y position of the island.
+         */
+        void SetPosition(int t_x, int t_y);
+
+        //-------------------------------------------------
+        // Changes
+        //-------------------------------------------------
+
+        /**
+         * @brief Checks whether the island has been moved or a layer has changed since the last `ClearChanges()`.
+         *
+         * @return True if there are changes; otherwise false.
+         */
+        [[nodiscard]] bool HasChanges() const;
+
+        /**
+         * @brief Checks whether a layer has changed on the screen since the last `ClearChanges()`.
+         *
+         * Only then must the draws of the island be recorded again.
+         *
+         * @return True if there are visible changes; otherwise false.
+         */
+        [[nodiscard]] bool HasVisibleChanges() const;
+
+        /**
+         * @brief Checks whether the island has been moved since the last `ClearChanges()`.
+         *
+         * @return True if the island has been moved; otherwise false.
+         */
+        [[nodiscard]] bool HasMoved() const { return m_moved; }
+
+        /**
+         * @brief Resets the changes after they have been processed.
+         */
+        void ClearChanges();
+
+        //-------------------------------------------------
+        // Animations
+        //-------------------------------------------------
+
+        /**
+         * @brief Sets the current frame of the animated tiles of all layers.
+         */
+        void UpdateAnimations();
+
         //-------------------------------------------------
         // New building
         //-------------------------------------------------
@@ -213,7 +303,7 @@ namespace mdcii::world
         physics::Aabb m_aabb;
 
         /**
-         * @brief The island terrain tile layers (COAST, TERRAIN, BUILDINGS, MIXED).
+         * @brief The island terrain tile layers (COAST, TERRAIN, BUILDINGS).
          */
         std::unordered_map<layer::LayerType, std::unique_ptr<layer::TerrainLayer<tile::TerrainTile>>, EnumClassHash> m_terrainLayers;
 
@@ -222,6 +312,26 @@ namespace mdcii::world
          */
         std::unique_ptr<layer::FiguresLayer<tile::FigureTile>> m_figuresLayer;
 
+        /**
+         * @brief The top-most tiles of the terrain layers.
+         */
+        std::unique_ptr<layer::MixedLayer> m_mixedLayer;
+
+        /**
+         * @brief The cached image of the static tiles.
+         */
+        std::unique_ptr<IslandImposter> m_imposter;
+
+        /**
+         * @brief Records the draws of the island, so that islands can be rendered in parallel.
+         */
+        std::unique_ptr<renderer::DrawList> m_drawList;
+
+        /**
+         * @brief True if the island has been moved since the last `ClearChanges()`.
+         */
+        bool m_moved{ false };
+
         /**
          * @brief Tiles to create a new building.
          */
@@ -276,27 +386,9 @@ namespace mdcii::world
         void InitLayerData();
 
         /**
-         * @brief Initialises the mixed layer of the island, which is created from all other layers.
-         */
-        void InitMixedLayerData();
-
-        /**
-         * @brief Populates the mixed layer with data from other layers.
-         *
-         * @param t_x The tile x position.
-         * @param t_y The tile y position.
-         */
-        void PopulateMixedLayer(int t_x, int t_y);
-
-        /**
-         * @brief Checks if a tile should be replaced in the mixed layer.
-         *
-         * @param t_layer Layer to check the tile from.
-         * @param t_index Index of the tile to check.
-         *
-         * @return True if the tile should be replaced; false otherwise.
+         * @brief Creates the mixed layer of the island, which is a view of all other terrain layers.
          */
-        bool ShouldReplaceTile(const layer::TerrainLayer<tile::TerrainTile>* t_layer, int t_index);
+        void InitMixedLayer();
     };
 
     //-------------------------------------------------
@@ -0,0 +1,525 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include "IslandImposter.h"
+#include "Island.h"
+#include "MdciiAssert.h"
+#include "Game.h"
+#include "job/TaskQueue.h"
+#include "state/State.h"
+#include "camera/Camera.h"
+#include "renderer/DrawList.h"
+#include "resource/AnimalsTileAtlas.h"
+
+//-------------------------------------------------
+// Ctors. / Dtor.
+//-------------------------------------------------
+
+mdcii::world::IslandImposter::IslandImposter(const Island* t_island)
+    : m_island{ t_island }
+{
+    MDCII_LOG_DEBUG("[IslandImposter::IslandImposter()] Create IslandImposter.");
+
+    MDCII_ASSERT(m_island, "[IslandImposter::IslandImposter()] Null pointer.")
+}
+
+mdcii::world::IslandImposter::~IslandImposter() noexcept
+{
+    MDCII_LOG_DEBUG("[IslandImposter::~IslandImposter()] Destruct IslandImposter.");
+
+    // the running Job may draw into a sprite of the images
+    WaitForJob();
+}
+
+//-------------------------------------------------
+// Getter
+//-------------------------------------------------
+
+bool mdcii::world::IslandImposter::IsReady() const
+{
+    const auto& image{ GetCurrentImage() };
+
+    return image.decal && &image != m_jobImage && !image.stale && image.dirtyPositions.empty() && !image.overlaysInvalid;
+}
+
+//-------------------------------------------------
+// Logic
+//-------------------------------------------------
+
+bool mdcii::world::IslandImposter::Update()
+{
+    ReleaseImages();
+
+    auto finished{ false };
+    if (m_job.valid())
+    {
+        if (m_job.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            return false;
+        }
+
+        FinishJob();
+        finished = true;
+    }
+
+    if (auto& image{ GetCurrentImage() }; !image.tooLarge && (image.stale || !image.dirtyPositions.empty() || image.overlaysInvalid))
+    {
+        StartJob(image);
+    }
+
+    return finished;
+}
+
+void mdcii::world::IslandImposter::Render(renderer::DrawList* t_drawList) const
+{
+    const auto* world{ m_island->world };
+
+    if (const auto& image{ GetCurrentImage() }; image.decal)
+    {
+        t_drawList->Add(
+            olc::vf2d(world->ToScreen(m_island->startX, m_island->startY) + image.offset),
+            image.decal.get(),
+            olc::WHITE
+        );
+    }
+}
+
+void mdcii::world::IslandImposter::RenderOverlays(const tile::TerrainTile& t_tile, renderer::DrawList* t_drawList) const
+{
+    const auto& image{ GetCurrentImage() };
+
+    // an image without static tiles has no overlays
+    if (image.firstOverlays.empty())
+    {
+        return;
+    }
+
+    const auto tileIndex{ t_tile.posY * m_island->width + t_tile.posX };
+    const auto first{ image.firstOverlays[tileIndex] };
+    const auto last{ image.firstOverlays[tileIndex + 1] };
+    if (first == last)
+    {
+        return;
+    }
+
+    const olc::vf2d islandPosition{ m_island->world->ToScreen(m_island->startX, m_island->startY) };
+    for (auto i{ first }; i < last; ++i)
+    {
+        const auto& overlay{ image.overlays[i] };
+        t_drawList->Add(islandPosition + overlay.position, overlay.decal, overlay.sourcePos, overlay.size, overlay.tint);
+    }
+}
+
+void mdcii::world::IslandImposter::WaitForJob() const
+{
+    if (m_job.valid())
+    {
+        m_job.wait();
+    }
+}
+
+void mdcii::world::IslandImposter::InvalidateTiles(const std::vector<tile::TerrainTile>& t_tiles)
+{
+    auto& currentImage{ GetCurrentImage() };
+
+    for (auto& images : m_images)
+    {
+        for (auto& image : images)
+        {
+            // a sprite that exists or is being created is only drawn again where the tiles have changed
+            if (&image == &currentImage && !image.stale && (image.sprite || &image == m_jobImage))
+            {
+                for (const auto& tile : t_tiles)
+                {
+                    image.dirtyPositions.emplace_back(tile.posX, tile.posY);
+                }
+            }
+            else
+            {
+                image.stale = true;
+            }
+
+            image.overlaysInvalid = true;
+        }
+    }
+}
+
+void mdcii::world::IslandImposter::InvalidateOverlays()
+{
+    for (auto& images : m_images)
+    {
+        for (auto& image : images)
+        {
+            image.overlaysInvalid = true;
+        }
+    }
+}
+
+//-------------------------------------------------
+// Helper
+//-------------------------------------------------
+
+mdcii::world::IslandImposter::Image& mdcii::world::IslandImposter::GetCurrentImage()
+{
+    const auto* camera{ m_island->world->camera.get() };
+
+    return m_images[magic_enum::enum_integer(camera->zoom)][magic_enum::enum_integer(camera->rotation)];
+}
+
+const mdcii::world::IslandImposter::Image& mdcii::world::IslandImposter::GetCurrentImage() const
+{
+    const auto* camera{ m_island->world->camera.get() };
+
+    return m_images[magic_enum::enum_integer(camera->zoom)][magic_enum::enum_integer(camera->rotation)];
+}
+
+void mdcii::world::IslandImposter::ReleaseImages()
+{
+    auto& currentImage{ GetCurrentImage() };
+    currentImage.lastUse = ++m_nrOfUpdates;
+
+    const auto releasable{ [&](const Image& t_image) { return t_image.sprite && &t_image != &currentImage && &t_image != m_jobImage; } };
+
+    // a stale image must be created again anyway
+    auto nrOfImages{ 0 };
+    for (auto& images : m_images)
+    {
+        for (auto& image : images)
+        {
+            if (releasable(image) && image.stale)
+            {
+                ReleaseImage(image);
+            }
+            else if (image.sprite)
+            {
+                ++nrOfImages;
+            }
+        }
+    }
+
+    while (nrOfImages > MAX_IMAGES)
+    {
+        Image* oldest{ nullptr };
+        for (auto& images : m_images)
+        {
+            for (auto& image : images)
+            {
+                if (releasable(image) && (!oldest || image.lastUse < oldest->lastUse))
+                {
+                    oldest = &image;
+                }
+            }
+        }
+
+        if (!oldest)
+        {
+            break;
+        }
+
+        ReleaseImage(*oldest);
+        --nrOfImages;
+    }
+}
+
+void mdcii::world::IslandImposter::ReleaseImage(Image& t_image)
+{
+    t_image.decal.reset();
+    t_image.sprite.reset();
+    t_image.stale = true;
+    t_image.dirtyPositions = {};
+    t_image.overlays = {};
+    t_image.firstOverlays = {};
+    t_image.overlaysInvalid = true;
+}
+
+void mdcii::world::IslandImposter::FinishJob()
+{
+    MDCII_ASSERT(m_jobImage, "[IslandImposter::FinishJob()] Null pointer.")
+
+    auto result{ m_job.get() };
+    auto& image{ *m_jobImage };
+    m_jobImage = nullptr;
+
+    // the old decal is not part of any draws because the image was not ready
+    if (result.sprite)
+    {
+        image.decal.reset();
+        image.sprite = std::move(result.sprite);
+        image.decal = std::make_unique<olc::Decal>(image.sprite.get());
+    }
+    else if (result.changed)
+    {
+        image.decal->Update();
+    }
+
+    image.overlays = std::move(result.overlays);
+    image.firstOverlays = std::move(result.firstOverlays);
+}
+
+void mdcii::world::IslandImposter::StartJob(Image& t_image)
+{
+    MDCII_ASSERT(!m_job.valid(), "[IslandImposter::StartJob()] A Job is already running.")
+
+    const auto* world{ m_island->world };
+
+    Job job;
+    job.bounds = CalcBounds();
+
+    if (t_image.stale)
+    {
+        if (job.bounds.size.x > MAX_SIZE || job.bounds.size.y > MAX_SIZE)
+        {
+            MDCII_LOG_DEBUG("[IslandImposter::StartJob()] The island is too large for an image ({}, {}).", job.bounds.size.x, job.bounds.size.y);
+            t_image.tooLarge = true;
+
+            return;
+        }
+
+        // a new sprite contains all changes
+        t_image.offset = job.bounds.position;
+        t_image.stale = false;
+    }
+    else
+    {
+        MDCII_ASSERT(t_image.sprite, "[IslandImposter::StartJob()] Null pointer.")
+
+        job.target = t_image.sprite.get();
+
+        const olc::vi2d islandPosition{ world->ToScreen(m_island->startX, m_island->startY) };
+        for (const auto& position : t_image.dirtyPositions)
+        {
+            const auto [cellPosition, cellSize]{ world->tileAtlas->CalcCellScreenArea(m_island->startX + position.x, m_island->startY + position.y) };
+            job.dirtyAreas.emplace_back(olc::vi2d(cellPosition) - islandPosition, cellSize);
+        }
+    }
+
+    t_image.dirtyPositions.clear();
+    t_image.overlaysInvalid = false;
+
+    CollectTiles(job.staticTiles, job.liveAreas);
+    job.nrOfTiles = m_island->width * m_island->height;
+    job.cellSize = get_tile_width(world->camera->zoom) * 2;
+
+    m_jobImage = &t_image;
+    m_job = world->state->game->taskQueue->Push([job{ std::move(job) }]() { return RunJob(job); });
+}
+
+mdcii::physics::Aabb mdcii::world::IslandImposter::CalcBounds() const
+{
+    const auto* world{ m_island->world };
+    const olc::vi2d islandPosition{ world->ToScreen(m_island->startX, m_island->startY) };
+
+    // the screen position is linear in the world position, so the corners of the island bound all tiles
+    olc::vi2d min{ std::numeric_limits<int>::max(), std::numeric_limits<int>::max() };
+    olc::vi2d max{ std::numeric_limits<int>::lowest(), std::numeric_limits<int>::lowest() };
+    for (const auto& corner : { olc::vi2d(0, 0), olc::vi2d(m_island->width - 1, 0), olc::vi2d(0, m_island->height - 1), olc::vi2d(m_island->width - 1, m_island->height - 1) })
+    {
+        const auto [position, size]{ world->tileAtlas->CalcCellScreenArea(m_island->startX + corner.x, m_island->startY + corner.y) };
+        min = min.min(olc::vi2d(position));
+        max = max.max(olc::vi2d(position + size));
+    }
+
+    return { min - islandPosition, max - min };
+}
+
+void mdcii::world::IslandImposter::CollectTiles(std::vector<StaticTile>& t_staticTiles, std::vector<LiveArea>& t_liveAreas) const
+{
+    const auto* world{ m_island->world };
+    const auto* figuresLayer{ m_island->GetFiguresLayer() };
+    const olc::vi2d islandPosition{ world->ToScreen(m_island->startX, m_island->startY) };
+
+    // the same order as the tiles are rendered
+    auto order{ 0 };
+    m_island->GetMixedLayer()->ForEachTile([&](const tile::TerrainTile& t_tile)
+    {
+        const auto x{ m_island->startX + t_tile.posX };
+        const auto y{ m_island->startY + t_tile.posY };
+
+        if (t_tile.IsAnimated())
+        {
+            const auto [position, size]{ world->tileAtlas->CalcCellScreenArea(x, y) };
+            t_liveAreas.push_back({ order, { olc::vi2d(position) - islandPosition, size } });
+        }
+        else if (auto draw{ world->tileAtlas->GetTileDraw(m_island->startX, m_island->startY, &t_tile) }; draw.decal)
+        {
+            draw.position -= olc::vf2d(islandPosition);
+            t_staticTiles.push_back({ t_tile.posY * m_island->width + t_tile.posX, order, draw, { draw.position, draw.size } });
+        }
+
+        // a figure is rendered after the terrain tile of its position
+        if (figuresLayer->GetTile(t_tile.posX, t_tile.posY).HasFigure())
+        {
+            const auto [position, size]{ world->animalsTileAtlas->CalcCellScreenArea(x, y) };
+            t_liveAreas.push_back({ order, { olc::vi2d(position) - islandPosition, size } });
+        }
+
+        ++order;
+    });
+}
+
+mdcii::world::IslandImposter::JobResult mdcii::world::IslandImposter::RunJob(const Job& t_job)
+{
+    JobResult result;
+
+    const auto& bounds{ t_job.bounds };
+    auto* target{ t_job.target };
+
+    if (!target)
+    {
+        result.sprite = std::make_unique<olc::Sprite>(bounds.size.x, bounds.size.y);
+        result.changed = true;
+
+        target = result.sprite.get();
+        std::fill_n(target->GetData(), bounds.size.x * static_cast<size_t>(bounds.size.y), olc::BLANK);
+
+        for (const auto& staticTile : t_job.staticTiles)
+        {
+            resource::TileAtlas::RenderTileToSprite(staticTile.draw, target, bounds.position, bounds);
+        }
+    }
+
+    // a changed area is cleared and all tiles overlapping it are drawn again in render order
+    for (const auto& dirtyArea : t_job.dirtyAreas)
+    {
+        const auto area{ physics::Aabb::Intersection(dirtyArea, bounds) };
+        if (area.size.x <= 0 || area.size.y <= 0)
+        {
+            continue;
+        }
+
+        const olc::vi2d position{ area.position - bounds.position };
+        for (auto y{ 0 }; y < area.size.y; ++y)
+        {
+            std::fill_n(target->GetData() + static_cast<size_t>(position.y + y) * target->width + position.x, area.size.x, olc::BLANK);
+        }
+
+        for (const auto& staticTile : t_job.staticTiles)
+        {
+            if (physics::Aabb::AabbVsAabb(staticTile.area, area))
+            {
+                resource::TileAtlas::RenderTileToSprite(staticTile.draw, target, bounds.position, area);
+            }
+        }
+
+        result.changed = true;
+    }
+
+    CreateOverlays(t_job, result);
+
+    return result;
+}
+
+void mdcii::world::IslandImposter::CreateOverlays(const Job& t_job, JobResult& t_result)
+{
+    const auto& staticTiles{ t_job.staticTiles };
+    const auto& liveAreas{ t_job.liveAreas };
+
+    // the static tiles by the cells of a coarse screen grid, so that only nearby tiles are tested
+    const auto cellSize{ t_job.cellSize };
+    const auto gridOrigin{ t_job.bounds.position };
+    const olc::vi2d gridSize{ t_job.bounds.size / cellSize + olc::vi2d(1, 1) };
+    const auto toCell{ [&](const olc::vi2d& t_position) { return ((t_position - gridOrigin) / cellSize).max({ 0, 0 }).min(gridSize - olc::vi2d(1, 1)); } };
+
+    std::vector<std::vector<int>> grid(gridSize.x * static_cast<size_t>(gridSize.y));
+    for (auto i{ 0 }; i < static_cast<int>(staticTiles.size()); ++i)
+    {
+        const auto& area{ staticTiles[i].area };
+        const auto first{ toCell(area.position) };
+        const auto last{ toCell(area.position + area.size - olc::vi2d(1, 1)) };
+        for (auto y{ first.y }; y <= last.y; ++y)
+        {
+            for (auto x{ first.x }; x <= last.x; ++x)
+            {
+                grid[y * gridSize.x + x].push_back(i);
+            }
+        }
+    }
+
+    // each static tile in front of an animated tile or a figure gets the overlapping part as overlay
+    std::vector<std::pair<int, Overlay>> overlays;
+    std::vector<int> lastTested(staticTiles.size(), -1);
+    for (auto i{ 0 }; i < static_cast<int>(liveAreas.size()); ++i)
+    {
+        const auto& [order, area]{ liveAreas[i] };
+        const auto first{ toCell(area.position) };
+        const auto last{ toCell(area.position + area.size - olc::vi2d(1, 1)) };
+        for (auto y{ first.y }; y <= last.y; ++y)
+        {
+            for (auto x{ first.x }; x <= last.x; ++x)
+            {
+                for (const auto index : grid[y * gridSize.x + x])
+                {
+                    // a tile can be in several grid cells
+                    if (lastTested[index] == i)
+                    {
+                        continue;
+                    }
+
+                    lastTested[index] = i;
+
+                    const auto& staticTile{ staticTiles[index] };
+                    if (staticTile.order <= order)
+                    {
+                        continue;
+                    }
+
+                    const auto overlap{ physics::Aabb::Intersection(staticTile.area, area) };
+                    if (overlap.size.x <= 0 || overlap.size.y <= 0)
+                    {
+                        continue;
+                    }
+
+                    overlays.emplace_back(
+                        staticTile.tileIndex,
+                        Overlay{
+                            staticTile.draw.decal,
+                            overlap.position,
+                            staticTile.draw.sourcePos + overlap.position - staticTile.area.position,
+                            overlap.size,
+                            staticTile.draw.tint
+                        }
+                    );
+                }
+            }
+        }
+    }
+
+    // group the overlays by tile index
+    auto& firstOverlays{ t_result.firstOverlays };
+    firstOverlays.assign(t_job.nrOfTiles + 1, 0);
+    for (const auto& [tileIndex, overlay] : overlays)
+    {
+        ++firstOverlays[tileIndex + 1];
+    }
+    for (auto i{ 1u }; i < firstOverlays.size(); ++i)
+    {
+        firstOverlays[i] += firstOverlays[i - 1];
+    }
+
+    std::vector<int32_t> next(firstOverlays.begin(), firstOverlays.end() - 1);
+    t_result.overlays.resize(overlays.size());
+    for (const auto& [tileIndex, overlay] : overlays)
+    {
+        t_result.overlays[next[tileIndex]++] = overlay;
+    }
+
+    MDCII_LOG_DEBUG("[IslandImposter::CreateOverlays()] Created {} overlays for {} animated tiles and figures.", overlays.size(), liveAreas.size());
+}
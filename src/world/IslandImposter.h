@@ -0,0 +1,490 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#pragma once
+
+#include <array>
+#include <future>
+#include <memory>
+#include <vector>
+#include "vendor/olc/olcPixelGameEngine.h"
+#include "world/Zoom.h"
+#include "world/Rotation.h"
+#include "physics/Aabb.h"
+#include "resource/TileAtlas.h"
+
+//-------------------------------------------------
+// Forward declarations
+//-------------------------------------------------
+
+namespace mdcii::renderer
+{
+    /**
+     * @brief Forward declaration class DrawList.
+     */
+    class DrawList;
+}
+
+namespace mdcii::world
+{
+    /**
+     * @brief Forward declaration class Island.
+     */
+    class Island;
+}
+
+namespace mdcii::world::tile
+{
+    /**
+     * @brief Forward declaration struct TerrainTile.
+     */
+    struct TerrainTile;
+}
+
+namespace mdcii::world
+{
+    //-------------------------------------------------
+    // IslandImposter
+    //-------------------------------------------------
+
+    /**
+     * @brief Caches the static tiles of an island in a sprite.
+     *
+     * An image is created for each zoom and rotation when it is needed for the first time.
+     * The tiles are drawn into the sprite on the TaskQueue; only the upload as a decal
+     * happens on the main thread. Only a few images are kept for each island. Added tiles are drawn again in the image of the current
+     * zoom and rotation, the other images are created again when they are needed next time.
+     *
+     * Animated tiles and figures are not part of the images and must be rendered on top
+     * in render order. A static tile in front of an animated tile or a figure would be
+     * overdrawn by it. Therefore, the parts of such a static tile that overlap the animated
+     * tile or the figure are drawn again after it as overlays.
+     */
+    class IslandImposter
+    {
+    public:
+        //-------------------------------------------------
+        // Ctors. / Dtor.
+        //-------------------------------------------------
+
+        IslandImposter() = delete;
+
+        /**
+         * @brief Constructs a new IslandImposter object.
+         *
+         * @param t_island Pointer to the parent Island object.
+         */
+        explicit IslandImposter(const Island* t_island);
+
+        IslandImposter(const IslandImposter& t_other) = delete;
+        IslandImposter(IslandImposter&& t_other) noexcept = delete;
+        IslandImposter& operator=(const IslandImposter& t_other) = delete;
+        IslandImposter& operator=(IslandImposter&& t_other) noexcept = delete;
+
+        ~IslandImposter() noexcept;
+
+        //-------------------------------------------------
+        // Getter
+        //-------------------------------------------------
+
+        /**
+         * @brief Checks whether the image for the current zoom and rotation is up to date.
+         *
+         * @return True if the image can be rendered instead of the static tiles.
+         */
+        [[nodiscard]] bool IsReady() const;
+
+        //-------------------------------------------------
+        // Logic
+        //-------------------------------------------------
+
+        /**
+         * @brief Uploads the result of a finished Job and starts a Job for the image of the current zoom and rotation.
+         *
+         * Must be called on the main thread each frame because the images are uploaded as decals.
+         *
+         * @return True if a Job has finished, so that the draws must be created again.
+         */
+        bool Update();
+
+        /**
+         * @brief Adds the image for the current zoom and rotation to a DrawList.
+         *
+         * @param t_drawList The DrawList to add to.
+         */
+        void Render(renderer::DrawList* t_drawList) const;
+
+        /**
+         * @brief Adds the overlays of a static tile to a DrawList.
+         *
+         * Must be called in render order after the animated tiles and figures behind the tile.
+         *
+         * @param t_tile The static tile.
+         * @param t_drawList The DrawList to add to.
+         */
+        void RenderOverlays(const tile::TerrainTile& t_tile, renderer::DrawList* t_drawList) const;
+
+        /**
+         * @brief Draws the changed tiles again in the image for the current zoom and rotation
+         *        and marks all other images as stale.
+         *
+         * @param t_tiles The changed tiles.
+         */
+        void InvalidateTiles(const std::vector<tile::TerrainTile>& t_tiles);
+
+        /**
+         * @brief Discards all overlays, e.g. after figures have been added or removed.
+         */
+        void InvalidateOverlays();
+
+        /**
+         * @brief Waits until the running Job, if any, has finished.
+         *
+         * The Job reads the pixels of the atlas images, so it must be finished before they are destroyed.
+         */
+        void WaitForJob() const;
+
+    protected:
+
+    private:
+        //-------------------------------------------------
+        // Types
+        //-------------------------------------------------
+
+        /**
+         * @brief The part of a static tile that is drawn again on top of an animated tile or a figure.
+         */
+        struct Overlay
+        {
+            /**
+             * @brief The decal of the atlas image.
+             */
+            olc::Decal* decal{ nullptr };
+
+            /**
+             * @brief The position relative to the screen position of the island origin.
+             */
+            olc::vf2d position;
+
+            /**
+             * @brief The top left position of the part in the atlas image.
+             */
+            olc::vf2d sourcePos;
+
+            /**
+             * @brief The size of the part.
+             */
+            olc::vf2d size;
+
+            /**
+             * @brief The color tint of the tile.
+             */
+            olc::Pixel tint;
+        };
+
+        /**
+         * @brief A static tile with its draw and its order.
+         *
+         * All positions are relative to the screen position of the island origin.
+         */
+        struct StaticTile
+        {
+            /**
+             * @brief The index of the tile in the island.
+             */
+            int tileIndex{ 0 };
+
+            /**
+             * @brief The position of the tile in render order.
+             */
+            int order{ 0 };
+
+            /**
+             * @brief Where and what to draw.
+             */
+            resource::TileAtlas::TileDraw draw;
+
+            /**
+             * @brief The area covered by the tile.
+             */
+            physics::Aabb area;
+        };
+
+        /**
+         * @brief The area that an animated tile or a figure can cover.
+         */
+        struct LiveArea
+        {
+            /**
+             * @brief The position of the tile in render order.
+             */
+            int order{ 0 };
+
+            /**
+             * @brief The area relative to the screen position of the island origin.
+             */
+            physics::Aabb area;
+        };
+
+        /**
+         * @brief The image of the island for a zoom and a rotation.
+         */
+        struct Image
+        {
+            /**
+             * @brief The sprite with the static tiles.
+             */
+            std::unique_ptr<olc::Sprite> sprite;
+
+            /**
+             * @brief The uploaded sprite.
+             */
+            std::unique_ptr<olc::Decal> decal;
+
+            /**
+             * @brief The position of the image relative to the screen position of the island origin.
+             */
+            olc::vi2d offset;
+
+            /**
+             * @brief True if the island is too large for an image.
+             */
+            bool tooLarge{ false };
+
+            /**
+             * @brief True if the sprite must be created again.
+             */
+            bool stale{ true };
+
+            /**
+             * @brief The positions of the tiles that must be drawn again.
+             */
+            std::vector<olc::vi2d> dirtyPositions;
+
+            /**
+             * @brief The overlays of all static tiles, grouped by tile.
+             */
+            std::vector<Overlay> overlays;
+
+            /**
+             * @brief The index of the first overlay of each tile index, followed by the number of overlays.
+             */
+            std::vector<int32_t> firstOverlays;
+
+            /**
+             * @brief True if the overlays must be created again.
+             */
+            bool overlaysInvalid{ true };
+
+            /**
+             * @brief The value of `m_nrOfUpdates` when the image was last the current image.
+             */
+            uint64_t lastUse{ 0 };
+        };
+
+        /**
+         * @brief The work for an image, which runs in the background.
+         *
+         * All positions are relative to the screen position of the island origin.
+         */
+        struct Job
+        {
+            /**
+             * @brief The sprite to draw into; nullptr to create a new sprite.
+             */
+            olc::Sprite* target{ nullptr };
+
+            /**
+             * @brief The area of the image.
+             */
+            physics::Aabb bounds;
+
+            /**
+             * @brief The areas of the changed tiles, which are drawn again in the target.
+             */
+            std::vector<physics::Aabb> dirtyAreas;
+
+            /**
+             * @brief The static tiles in render order.
+             */
+            std::vector<StaticTile> staticTiles;
+
+            /**
+             * @brief The areas of the animated tiles and figures in render order.
+             */
+            std::vector<LiveArea> liveAreas;
+
+            /**
+             * @brief The number of tiles of the island.
+             */
+            int nrOfTiles{ 0 };
+
+            /**
+             * @brief The cell size of the screen grid, which is used to find nearby tiles.
+             */
+            int cellSize{ 0 };
+        };
+
+        /**
+         * @brief The result of a Job.
+         */
+        struct JobResult
+        {
+            /**
+             * @brief The new sprite or nullptr if the target has been drawn into.
+             */
+            std::unique_ptr<olc::Sprite> sprite;
+
+            /**
+             * @brief True if the sprite must be uploaded.
+             */
+            bool changed{ false };
+
+            /**
+             * @brief The overlays, grouped by tile.
+             */
+            std::vector<Overlay> overlays;
+
+            /**
+             * @brief The index of the first overlay of each tile index, followed by the number of overlays.
+             */
+            std::vector<int32_t> firstOverlays;
+        };
+
+        //-------------------------------------------------
+        // Constants
+        //-------------------------------------------------
+
+        /**
+         * @brief The maximum width and height of an image.
+         */
+        static constexpr auto MAX_SIZE{ 4096 };
+
+        /**
+         * @brief The maximum number of images with a sprite, including the current image.
+         */
+        static constexpr auto MAX_IMAGES{ 2 };
+
+        //-------------------------------------------------
+        // Member
+        //-------------------------------------------------
+
+        /**
+         * @brief Pointer to the parent Island object.
+         */
+        const Island* m_island{ nullptr };
+
+        /**
+         * @brief The images for each zoom and rotation.
+         */
+        std::array<std::array<Image, magic_enum::enum_count<Rotation>()>, NR_OF_ZOOMS> m_images;
+
+        /**
+         * @brief The running Job, if any.
+         */
+        std::future<JobResult> m_job;
+
+        /**
+         * @brief The image of the running Job.
+         */
+        Image* m_jobImage{ nullptr };
+
+        /**
+         * @brief Counts the calls of `Update()` to find the least recently used images.
+         */
+        uint64_t m_nrOfUpdates{ 0 };
+
+        //-------------------------------------------------
+        // Helper
+        //-------------------------------------------------
+
+        /**
+         * @brief Getter for the image of the current zoom and rotation.
+         *
+         * @return The image.
+         */
+        [[nodiscard]] Image& GetCurrentImage();
+
+        /**
+         * @brief Getter for the image of the current zoom and rotation.
+         *
+         * @return The image.
+         */
+        [[nodiscard]] const Image& GetCurrentImage() const;
+
+        /**
+         * @brief Releases the stale images and the least recently used images beyond `MAX_IMAGES`.
+         *
+         * The current image and the image of the running Job are kept.
+         */
+        void ReleaseImages();
+
+        /**
+         * @brief Releases the sprite, the decal and the overlays of an image.
+         *
+         * @param t_image The image to release.
+         */
+        static void ReleaseImage(Image& t_image);
+
+        /**
+         * @brief Uploads the result of the finished Job.
+         */
+        void FinishJob();
+
+        /**
+         * @brief Starts a Job for the image of the current zoom and rotation.
+         *
+         * @param t_image The image of the current zoom and rotation.
+         */
+        void StartJob(Image& t_image);
+
+        /**
+         * @brief Calculates the area that the tiles of the island can cover.
+         *
+         * @return The area relative to the screen position of the island origin.
+         */
+        [[nodiscard]] physics::Aabb CalcBounds() const;
+
+        /**
+         * @brief Collects the static tiles and the areas of the animated tiles and figures in render order.
+         *
+         * @param t_staticTiles Receives the static tiles.
+         * @param t_liveAreas Receives the areas of the animated tiles and figures.
+         */
+        void CollectTiles(std::vector<StaticTile>& t_staticTiles, std::vector<LiveArea>& t_liveAreas) const;
+
+        /**
+         * @brief Draws the static tiles into a sprite and creates the overlays.
+         *
+         * Runs in the background, so only the data of the Job may be used.
+         *
+         * @param t_job The Job.
+         *
+         * @return The JobResult.
+         */
+        static JobResult RunJob(const Job& t_job);
+
+        /**
+         * @brief Creates the overlays of the static tiles that are in front of an animated tile or a figure.
+         *
+         * @param t_job The Job with the static tiles and the areas of the animated tiles and figures.
+         * @param t_result Receives the overlays.
+         */
+        static void CreateOverlays(const Job& t_job, JobResult& t_result);
+    };
+}
@@ -17,6 +17,7 @@
 // Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
 
 #include "MousePicker.h"
+#include "Profiler.h"
 #include "MdciiAssert.h"
 #include "Game.h"
 #include "resource/AssetManager.h"
@@ -48,6 +49,8 @@ mdcii::world::MousePicker::~MousePicker() noexcept
 
 void mdcii::world::MousePicker::OnUserUpdate()
 {
+    MDCII_PROFILE_SCOPE("MousePicker::OnUserUpdate");
+
     UpdateMousePosition();
 
     const auto* cheatSprite{ m_world->state->game->assetManager->GetAsset(resource::Asset::CHEAT, m_world->camera->zoom)->Sprite() };
@@ -0,0 +1,94 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#include <algorithm>
+#include "OccupancyGrid.h"
+#include "MdciiAssert.h"
+
+//-------------------------------------------------
+// Ctors. / Dtor.
+//-------------------------------------------------
+
+mdcii::world::OccupancyGrid::OccupancyGrid(const int t_width, const int t_height)
+    : m_width{ t_width }
+    , m_height{ t_height }
+{
+    MDCII_LOG_DEBUG("[OccupancyGrid::OccupancyGrid()] Create OccupancyGrid.");
+
+    MDCII_ASSERT(m_width > 0 && m_height > 0, "[OccupancyGrid::OccupancyGrid()] Invalid size.")
+
+    m_cells.resize(m_width * static_cast<size_t>(m_height), NO_ISLAND);
+}
+
+mdcii::world::OccupancyGrid::~OccupancyGrid() noexcept
+{
+    MDCII_LOG_DEBUG("[OccupancyGrid::~OccupancyGrid()] Destruct OccupancyGrid.");
+}
+
+//-------------------------------------------------
+// Getter
+//-------------------------------------------------
+
+int32_t mdcii::world::OccupancyGrid::GetIslandIndex(const int t_x, const int t_y) const
+{
+    if (t_x < 0 || t_x >= m_width || t_y < 0 || t_y >= m_height)
+    {
+        return NO_ISLAND;
+    }
+
+    return m_cells[t_y * m_width + t_x];
+}
+
+bool mdcii::world::OccupancyGrid::IsAreaFree(const int t_x, const int t_y, const int t_width, const int t_height) const
+{
+    if (t_x < 0 || t_y < 0 || t_x + t_width > m_width || t_y + t_height > m_height)
+    {
+        return false;
+    }
+
+    for (auto y{ t_y }; y < t_y + t_height; ++y)
+    {
+        for (auto x{ t_x }; x < t_x + t_width; ++x)
+        {
+            if (m_cells[y * m_width + x] != NO_ISLAND)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+//-------------------------------------------------
+// Setter
+//-------------------------------------------------
+
+void mdcii::world::OccupancyGrid::AddIsland(const int32_t t_islandIndex, const int t_x, const int t_y, const int t_width, const int t_height)
+{
+    MDCII_ASSERT(t_islandIndex >= 0, "[OccupancyGrid::AddIsland()] Invalid island index.")
+
+    // islands may partially lie outside the world
+    for (auto y{ std::max(0, t_y) }; y < std::min(m_height, t_y + t_height); ++y)
+    {
+        for (auto x{ std::max(0, t_x) }; x < std::min(m_width, t_x + t_width); ++x)
+        {
+            m_cells[y * m_width + x] = t_islandIndex;
+        }
+    }
+}
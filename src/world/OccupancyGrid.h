@@ -0,0 +1,129 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+namespace mdcii::world
+{
+    //-------------------------------------------------
+    // OccupancyGrid
+    //-------------------------------------------------
+
+    /**
+     * @brief Stores for each world position the index of the island covering it.
+     */
+    class OccupancyGrid
+    {
+    public:
+        //-------------------------------------------------
+        // Constants
+        //-------------------------------------------------
+
+        /**
+         * @brief The value of a position without an island.
+         */
+        static constexpr int32_t NO_ISLAND{ -1 };
+
+        //-------------------------------------------------
+        // Ctors. / Dtor.
+        //-------------------------------------------------
+
+        OccupancyGrid() = delete;
+
+        /**
+         * @brief Constructs a new OccupancyGrid object.
+         *
+         * @param t_width The width of the world in tiles.
+         * @param t_height The height of the world in tiles.
+         */
+        OccupancyGrid(int t_width, int t_height);
+
+        OccupancyGrid(const OccupancyGrid& t_other) = delete;
+        OccupancyGrid(OccupancyGrid&& t_other) noexcept = delete;
+        OccupancyGrid& operator=(const OccupancyGrid& t_other) = delete;
+        OccupancyGrid& operator=(OccupancyGrid&& t_other) noexcept = delete;
+
+        ~OccupancyGrid() noexcept;
+
+        //-------------------------------------------------
+        // Getter
+        //-------------------------------------------------
+
+        /**
+         * @brief Determines the island covering a world position.
+         *
+         * @param t_x The x position.
+         * @param t_y The y position.
+         *
+         * @return The index of the island or `NO_ISLAND`, also for positions outside the world.
+         */
+        [[nodiscard]] int32_t GetIslandIndex(int t_x, int t_y) const;
+
+        /**
+         * @brief Checks whether an area lies within the world and is not covered by any island.
+         *
+         * @param t_x The x position of the area.
+         * @param t_y The y position of the area.
+         * @param t_width The width of the area.
+         * @param t_height The height of the area.
+         *
+         * @return True if the area is free; otherwise false.
+         */
+        [[nodiscard]] bool IsAreaFree(int t_x, int t_y, int t_width, int t_height) const;
+
+        //-------------------------------------------------
+        // Setter
+        //-------------------------------------------------
+
+        /**
+         * @brief Marks an area as covered by an island.
+         *
+         * @param t_islandIndex The index of the island.
+         * @param t_x The x position of the island.
+         * @param t_y The y position of the island.
+         * @param t_width The width of the island.
+         * @param t_height The height of the island.
+         */
+        void AddIsland(int32_t t_islandIndex, int t_x, int t_y, int t_width, int t_height);
+
+    protected:
+
+    private:
+        //-------------------------------------------------
+        // Member
+        //-------------------------------------------------
+
+        /**
+         * @brief The width of the world in tiles.
+         */
+        int m_width{ 0 };
+
+        /**
+         * @brief The height of the world in tiles.
+         */
+        int m_height{ 0 };
+
+        /**
+         * @brief The island index for each world position, row by row.
+         */
+        std::vector<int32_t> m_cells;
+    };
+}
@@ -0,0 +1,122 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#include "Population.h"
+#include "MdciiAssert.h"
+#include "MdciiRandom.h"
+#include "World.h"
+#include "Island.h"
+
+//-------------------------------------------------
+// Ctors. / Dtor.
+//-------------------------------------------------
+
+mdcii::world::Population::Population(World* t_world)
+    : m_world{ t_world }
+{
+    MDCII_LOG_DEBUG("[Population::Population()] Create Population.");
+
+    MDCII_ASSERT(m_world, "[Population::Population()] Null pointer.")
+}
+
+mdcii::world::Population::~Population() noexcept
+{
+    MDCII_LOG_DEBUG("[Population::~Population()] Destruct Population.");
+}
+
+//-------------------------------------------------
+// Logic
+//-------------------------------------------------
+
+void mdcii::world::Population::OnUserUpdate(const float t_elapsedTime)
+{
+    m_timer += t_elapsedTime;
+    if (m_timer < SPAWN_INTERVAL)
+    {
+        return;
+    }
+
+    m_timer = 0.0f;
+
+    // islands can be added at runtime (e.g. by the WorldGenerator)
+    while (m_eligiblePositions.size() < m_world->islands.size())
+    {
+        m_eligiblePositions.push_back(FindEligiblePositions(m_world->islands[m_eligiblePositions.size()].get()));
+    }
+
+    for (auto i{ 0u }; i < m_world->islands.size(); ++i)
+    {
+        if (auto* island{ m_world->islands[i].get() };
+            !m_eligiblePositions[i].empty() && island->GetFiguresLayer()->CountFigures(resource::FigureId::DEER_ID) < MAX_DEER)
+        {
+            SpawnDeer(island, m_eligiblePositions[i]);
+        }
+    }
+}
+
+//-------------------------------------------------
+// Helper
+//-------------------------------------------------
+
+std::vector<olc::vi2d> mdcii::world::Population::FindEligiblePositions(const Island* t_island)
+{
+    std::vector<olc::vi2d> positions;
+
+    for (auto y{ 0 }; y < t_island->height; ++y)
+    {
+        for (auto x{ 0 }; x < t_island->width; ++x)
+        {
+            if (IsEligiblePosition(t_island, { x, y }))
+            {
+                positions.emplace_back(x, y);
+            }
+        }
+    }
+
+    MDCII_LOG_DEBUG("[Population::FindEligiblePositions()] Found {} positions for animals.", positions.size());
+
+    return positions;
+}
+
+bool mdcii::world::Population::IsEligiblePosition(const Island* t_island, const olc::vi2d& t_position)
+{
+    using enum layer::LayerType;
+
+    return t_island->GetTerrainLayer(TERRAIN)->GetTile(t_position.x, t_position.y).HasBuildingAboveWaterAndCoast() &&
+           !t_island->GetTerrainLayer(BUILDINGS)->GetTile(t_position.x, t_position.y).HasBuilding() &&
+           !t_island->GetFiguresLayer()->GetTile(t_position.x, t_position.y).HasFigure();
+}
+
+void mdcii::world::Population::SpawnDeer(Island* t_island, const std::vector<olc::vi2d>& t_positions) const
+{
+    // the list is not updated when buildings are added, so the position is checked again
+    const auto& position{ t_positions[mdcii_uniform_random_int<size_t>(0, t_positions.size() - 1)] };
+    if (!IsEligiblePosition(t_island, position))
+    {
+        return;
+    }
+
+    MDCII_LOG_DEBUG("[Population::SpawnDeer()] Create new deer at ({}, {}).", position.x, position.y);
+
+    t_island->GetFiguresLayer()->AddFigure(
+        position.x, position.y,
+        &m_world->state->game->originalResourcesManager->GetFigureById(resource::FigureId::DEER_ID),
+        mdcii_uniform_random_int<int>(1, 4),
+        1
+    );
+}
@@ -0,0 +1,152 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#pragma once
+
+#include <vector>
+#include "vendor/olc/olcPixelGameEngine.h"
+
+namespace mdcii::world
+{
+    //-------------------------------------------------
+    // Forward declarations
+    //-------------------------------------------------
+
+    /**
+     * Forward declaration class World.
+     */
+    class World;
+
+    /**
+     * Forward declaration class Island.
+     */
+    class Island;
+
+    //-------------------------------------------------
+    // Population
+    //-------------------------------------------------
+
+    /**
+     * @brief Spawns the animals on the islands.
+     *
+     * The positions where an animal can live are collected once per island.
+     * At a fixed rate a random position is picked and an animal is placed there,
+     * as long as the island has fewer animals than allowed.
+     */
+    class Population
+    {
+    public:
+        //-------------------------------------------------
+        // Ctors. / Dtor.
+        //-------------------------------------------------
+
+        Population() = delete;
+
+        /**
+         * @brief Constructs a new Population object.
+         *
+         * @param t_world Pointer to the parent World object.
+         */
+        explicit Population(World* t_world);
+
+        Population(const Population& t_other) = delete;
+        Population(Population&& t_other) noexcept = delete;
+        Population& operator=(const Population& t_other) = delete;
+        Population& operator=(Population&& t_other) noexcept = delete;
+
+        ~Population() noexcept;
+
+        //-------------------------------------------------
+        // Logic
+        //-------------------------------------------------
+
+        /**
+         * @brief Spawns new animals when the spawn interval has expired.
+         *
+         * @param t_elapsedTime The time since the last call.
+         */
+        void OnUserUpdate(float t_elapsedTime);
+
+    protected:
+
+    private:
+        //-------------------------------------------------
+        // Constants
+        //-------------------------------------------------
+
+        /**
+         * @brief The maximum number of deer per island.
+         */
+        static constexpr auto MAX_DEER{ 3 };
+
+        /**
+         * @brief The time in seconds between two spawn attempts.
+         */
+        static constexpr auto SPAWN_INTERVAL{ 1.0f };
+
+        //-------------------------------------------------
+        // Member
+        //-------------------------------------------------
+
+        /**
+         * @brief Pointer to the parent World object.
+         */
+        World* m_world{ nullptr };
+
+        /**
+         * @brief The time since the last spawn attempt.
+         */
+        float m_timer{ 0.0f };
+
+        /**
+         * @brief The possible positions of an animal for each island, in the order of `World::islands`.
+         */
+        std::vector<std::vector<olc::vi2d>> m_eligiblePositions;
+
+        //-------------------------------------------------
+        // Helper
+        //-------------------------------------------------
+
+        /**
+         * @brief Collects the positions of an island where an animal can live.
+         *
+         * @param t_island Pointer to the Island object.
+         *
+         * @return The positions relative to the island.
+         */
+        [[nodiscard]] static std::vector<olc::vi2d> FindEligiblePositions(const Island* t_island);
+
+        /**
+         * @brief Checks whether an animal can be placed at a position.
+         *
+         * @param t_island Pointer to the Island object.
+         * @param t_position The position relative to the island.
+         *
+         * @return True if the position is free; otherwise false.
+         */
+        [[nodiscard]] static bool IsEligiblePosition(const Island* t_island, const olc::vi2d& t_position);
+
+        /**
+         * @brief Places a deer at a random eligible position of an island.
+         *
+         * @param t_island Pointer to the Island object.
+         * @param t_positions The eligible positions of the island.
+         */
+        void SpawnDeer(Island* t_island, const std::vector<olc::vi2d>& t_positions) const;
+    };
+}
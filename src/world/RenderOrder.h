@@ -0,0 +1,96 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#pragma once
+
+#include "Rotation.h"
+
+namespace mdcii::world
+{
+    //-------------------------------------------------
+    // Render order
+    //-------------------------------------------------
+
+    /**
+     * @brief Calculates the position of a map position in the painter's order of the given rotation.
+     *
+     * The tiles are rendered row by row from the top of the rotated map,
+     * so that tiles in front are drawn over the tiles behind them.
+     *
+     * @param t_mapX The x position on the map.
+     * @param t_mapY The y position on the map.
+     * @param t_width The width of the map.
+     * @param t_height The height of the map.
+     * @param t_rotation The rotation.
+     *
+     * @return The position in the render order in the range [0, width * height).
+     */
+    inline int get_sorted_position(
+        const int t_mapX, const int t_mapY,
+        const int t_width, const int t_height,
+        const Rotation t_rotation = Rotation::DEG0
+    )
+    {
+        switch (t_rotation)
+        {
+        case Rotation::DEG0:
+            return t_mapY * t_width + t_mapX;
+        case Rotation::DEG90:
+            return t_mapX * t_height + (t_height - 1 - t_mapY);
+        case Rotation::DEG180:
+            return (t_height - 1 - t_mapY) * t_width + (t_width - 1 - t_mapX);
+        case Rotation::DEG270:
+            return (t_width - 1 - t_mapX) * t_height + t_mapY;
+        }
+
+        throw MDCII_EXCEPTION("[get_sorted_position()] Invalid rotation given.");
+    }
+
+    /**
+     * @brief Calculates the map position at a position in the painter's order of the given rotation.
+     *
+     * This is the inverse of `get_sorted_position()`.
+     *
+     * @param t_sortedPosition The position in the render order.
+     * @param t_width The width of the map.
+     * @param t_height The height of the map.
+     * @param t_rotation The rotation.
+     *
+     * @return The position on the map.
+     */
+    inline olc::vi2d get_map_position(
+        const int t_sortedPosition,
+        const int t_width, const int t_height,
+        const Rotation t_rotation = Rotation::DEG0
+    )
+    {
+        switch (t_rotation)
+        {
+        case Rotation::DEG0:
+            return { t_sortedPosition % t_width, t_sortedPosition / t_width };
+        case Rotation::DEG90:
+            return { t_sortedPosition / t_height, t_height - 1 - t_sortedPosition % t_height };
+        case Rotation::DEG180:
+            return { t_width - 1 - t_sortedPosition % t_width, t_height - 1 - t_sortedPosition / t_width };
+        case Rotation::DEG270:
+            return { t_width - 1 - t_sortedPosition / t_height, t_sortedPosition % t_height };
+        }
+
+        throw MDCII_EXCEPTION("[get_map_position()] Invalid rotation given.");
+    }
+}
@@ -0,0 +1,231 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#include <algorithm>
+#include "Viewport.h"
+#include "MdciiAssert.h"
+#include "Game.h"
+#include "world/World.h"
+#include "camera/Camera.h"
+
+//-------------------------------------------------
+// Ctors. / Dtor.
+//-------------------------------------------------
+
+mdcii::world::Viewport::Viewport(const World* t_world)
+    : m_world{ t_world }
+{
+    MDCII_LOG_DEBUG("[Viewport::Viewport()] Create Viewport.");
+
+    MDCII_ASSERT(m_world, "[Viewport::Viewport()] Null pointer.")
+
+    m_windowWidth = Game::INI.Get<int>("window", "width");
+    m_windowHeight = Game::INI.Get<int>("window", "height");
+}
+
+mdcii::world::Viewport::~Viewport() noexcept
+{
+    MDCII_LOG_DEBUG("[Viewport::~Viewport()] Destruct Viewport.");
+}
+
+//-------------------------------------------------
+// Logic
+//-------------------------------------------------
+
+bool mdcii::world::Viewport::Update()
+{
+    const auto& camera{ *m_world->camera };
+
+    const auto tileWidthHalf{ get_tile_width_half(camera.zoom) };
+    const auto tileHeightHalf{ get_tile_height_half(camera.zoom) };
+
+    // screen x = camera x + (x - y) * tile width half; valid in [-tile width half, window width + tile width]
+    const auto uMin{ CeilDiv(-tileWidthHalf - camera.screenPosition.x, tileWidthHalf) };
+    const auto uMax{ FloorDiv(m_windowWidth + get_tile_width(camera.zoom) - camera.screenPosition.x, tileWidthHalf) };
+
+    // screen y = camera y + (x + y) * tile height half; valid in [-tile height half, window height + tile height]
+    const auto vMin{ CeilDiv(-tileHeightHalf - camera.screenPosition.y, tileHeightHalf) };
+    const auto vMax{ FloorDiv(m_windowHeight + get_tile_height(camera.zoom) - camera.screenPosition.y, tileHeightHalf) };
+
+    if (camera.zoom == m_zoom && camera.rotation == m_rotation && uMin == m_uMin && uMax == m_uMax && vMin == m_vMin && vMax == m_vMax)
+    {
+        return false;
+    }
+
+    m_zoom = camera.zoom;
+    m_rotation = camera.rotation;
+    m_uMin = uMin;
+    m_uMax = uMax;
+    m_vMin = vMin;
+    m_vMax = vMax;
+
+    m_screenAabb = physics::Aabb(
+        olc::vi2d(-tileWidthHalf - camera.screenPosition.x, -tileHeightHalf - camera.screenPosition.y),
+        olc::vi2d(m_windowWidth + get_tile_width(camera.zoom) + tileWidthHalf + 1, m_windowHeight + get_tile_height(camera.zoom) + tileHeightHalf + 1)
+    );
+
+    return true;
+}
+
+//-------------------------------------------------
+// Culling
+//-------------------------------------------------
+
+bool mdcii::world::Viewport::IsWorldPositionVisible(const int t_x, const int t_y) const
+{
+    const auto position{ rotate_position(t_x, t_y, m_world->worldWidth, m_world->worldHeight, m_rotation) };
+    const auto u{ position.x - position.y };
+    const auto v{ position.x + position.y };
+
+    return u >= m_uMin && u <= m_uMax && v >= m_vMin && v <= m_vMax;
+}
+
+void mdcii::world::Viewport::CalcVisibleSpans(
+    const int t_startX, const int t_startY,
+    const int t_width, const int t_height,
+    const int32_t t_chunk,
+    std::vector<TileSpan>& t_spans
+) const
+{
+    const auto firstSpan{ t_spans.size() };
+
+    const auto area{ ToRotatedArea(t_startX, t_startY, t_width, t_height, m_rotation) };
+    if (!Overlaps(area))
+    {
+        return;
+    }
+
+    // a tile at (column, row) has u = uOffset + column - row and v = vOffset + column + row
+    const auto& [uOffset, vOffset, rowLength, rows]{ area };
+
+    const auto firstRow{ std::max(0, m_vMin - vOffset - (rowLength - 1)) };
+    const auto lastRow{ std::min(rows - 1, m_vMax - vOffset) };
+
+    for (auto row{ firstRow }; row <= lastRow; ++row)
+    {
+        const auto firstColumn{ std::max({ 0, m_uMin - uOffset + row, m_vMin - vOffset - row }) };
+        const auto lastColumn{ std::min({ rowLength - 1, m_uMax - uOffset + row, m_vMax - vOffset - row }) };
+
+        if (firstColumn > lastColumn)
+        {
+            continue;
+        }
+
+        const auto begin{ row * rowLength + firstColumn };
+        const auto end{ row * rowLength + lastColumn + 1 };
+
+        // merge with the previous span of this area if there is no gap
+        if (t_spans.size() > firstSpan && t_spans.back().end == begin)
+        {
+            t_spans.back().end = end;
+        }
+        else
+        {
+            t_spans.push_back({ t_chunk, begin, end });
+        }
+    }
+}
+
+bool mdcii::world::Viewport::IsAreaVisible(const int t_startX, const int t_startY, const int t_width, const int t_height) const
+{
+    return Overlaps(ToRotatedArea(t_startX, t_startY, t_width, t_height, m_rotation));
+}
+
+mdcii::physics::Aabb mdcii::world::Viewport::CalcScreenAabb(
+    const int t_startX, const int t_startY,
+    const int t_width, const int t_height,
+    const Zoom t_zoom,
+    const Rotation t_rotation
+) const
+{
+    const auto area{ ToRotatedArea(t_startX, t_startY, t_width, t_height, t_rotation) };
+
+    const auto uMin{ area.uOffset - (area.rows - 1) };
+    const auto uMax{ area.uOffset + (area.rowLength - 1) };
+    const auto vMin{ area.vOffset };
+    const auto vMax{ area.vOffset + (area.rowLength - 1) + (area.rows - 1) };
+
+    return {
+        olc::vi2d(uMin * get_tile_width_half(t_zoom), vMin * get_tile_height_half(t_zoom)),
+        olc::vi2d((uMax - uMin) * get_tile_width_half(t_zoom) + 1, (vMax - vMin) * get_tile_height_half(t_zoom) + 1)
+    };
+}
+
+//-------------------------------------------------
+// Helper
+//-------------------------------------------------
+
+mdcii::world::Viewport::RotatedArea mdcii::world::Viewport::ToRotatedArea(
+    const int t_startX, const int t_startY,
+    const int t_width, const int t_height,
+    const Rotation t_rotation
+) const
+{
+    // the rotated world position of the first tile in the render order and the size of a row
+    auto originX{ t_startX };
+    auto originY{ t_startY };
+    auto rowLength{ t_width };
+    auto rows{ t_height };
+
+    switch (t_rotation)
+    {
+    case Rotation::DEG0:
+        break;
+    case Rotation::DEG90:
+        originX = m_world->worldWidth - t_startY - t_height;
+        originY = t_startX;
+        rowLength = t_height;
+        rows = t_width;
+        break;
+    case Rotation::DEG180:
+        originX = m_world->worldWidth - t_startX - t_width;
+        originY = m_world->worldHeight - t_startY - t_height;
+        break;
+    case Rotation::DEG270:
+        originX = t_startY;
+        originY = m_world->worldHeight - t_startX - t_width;
+        rowLength = t_height;
+        rows = t_width;
+        break;
+    }
+
+    return { originX - originY, originX + originY, rowLength, rows };
+}
+
+bool mdcii::world::Viewport::Overlaps(const RotatedArea& t_area) const
+{
+    // u is smallest in the first column of the last row and largest in the last column of the first row
+    const auto uMin{ t_area.uOffset - (t_area.rows - 1) };
+    const auto uMax{ t_area.uOffset + (t_area.rowLength - 1) };
+
+    // v is smallest at the first and largest at the last position
+    const auto vMin{ t_area.vOffset };
+    const auto vMax{ t_area.vOffset + (t_area.rowLength - 1) + (t_area.rows - 1) };
+
+    return uMax >= m_uMin && uMin <= m_uMax && vMax >= m_vMin && vMin <= m_vMax;
+}
+
+int mdcii::world::Viewport::FloorDiv(const int t_a, const int t_b)
+{
+    return t_a / t_b - (t_a % t_b != 0 && (t_a < 0) != (t_b < 0));
+}
+
+int mdcii::world::Viewport::CeilDiv(const int t_a, const int t_b)
+{
+    return t_a / t_b + (t_a % t_b != 0 && (t_a < 0) == (t_b < 0));
+}
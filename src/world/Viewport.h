@@ -0,0 +1,293 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include "Rotation.h"
+#include "Zoom.h"
+#include "physics/Aabb.h"
+
+namespace mdcii::world
+{
+    //-------------------------------------------------
+    // Forward declarations
+    //-------------------------------------------------
+
+    /**
+     * Forward declaration class World.
+     */
+    class World;
+
+    //-------------------------------------------------
+    // TileSpan
+    //-------------------------------------------------
+
+    /**
+     * @brief A range [begin, end) of positions in the render order of a layer chunk.
+     */
+    struct TileSpan
+    {
+        /**
+         * @brief The index of the chunk.
+         */
+        int32_t chunk{ 0 };
+
+        /**
+         * @brief The first position in the render order.
+         */
+        int32_t begin{ 0 };
+
+        /**
+         * @brief One past the last position in the render order.
+         */
+        int32_t end{ 0 };
+    };
+
+    //-------------------------------------------------
+    // Viewport
+    //-------------------------------------------------
+
+    /**
+     * @brief Determines which tiles are on the screen.
+     *
+     * A tile is visible if its screen position lies within the window
+     * (extended by one tile). In the rotated world the screen x position only
+     * depends on `x - y` and the screen y position only on `x + y`. Both ranges are
+     * calculated once per camera change, so that each row of a layer is visible
+     * in exactly one contiguous range of columns.
+     */
+    class Viewport
+    {
+    public:
+        //-------------------------------------------------
+        // Ctors. / Dtor.
+        //-------------------------------------------------
+
+        Viewport() = delete;
+
+        /**
+         * @brief Constructs a new Viewport object.
+         *
+         * @param t_world Pointer to the parent World object.
+         */
+        explicit Viewport(const World* t_world);
+
+        Viewport(const Viewport& t_other) = delete;
+        Viewport(Viewport&& t_other) noexcept = delete;
+        Viewport& operator=(const Viewport& t_other) = delete;
+        Viewport& operator=(Viewport&& t_other) noexcept = delete;
+
+        ~Viewport() noexcept;
+
+        //-------------------------------------------------
+        // Logic
+        //-------------------------------------------------
+
+        /**
+         * @brief Recalculates the visible area for the current camera position, zoom and rotation.
+         *
+         * @return True if the visible area has changed; otherwise false.
+         */
+        [[nodiscard]] bool Update();
+
+        //-------------------------------------------------
+        // Culling
+        //-------------------------------------------------
+
+        /**
+         * @brief Checks whether the given world position is visible on the screen.
+         *
+         * @param t_x The x position.
+         * @param t_y The y position.
+         *
+         * @return True if the position is visible. Otherwise, it returns false.
+         */
+        [[nodiscard]] bool IsWorldPositionVisible(int t_x, int t_y) const;
+
+        /**
+         * @brief Calculates the visible positions of an area in the render order of the current rotation.
+         *
+         * @param t_startX The world x position of the area.
+         * @param t_startY The world y position of the area.
+         * @param t_width The width of the area.
+         * @param t_height The height of the area.
+         * @param t_chunk The chunk index stored in each span.
+         * @param t_spans The visible ranges are appended in ascending order.
+         */
+        void CalcVisibleSpans(int t_startX, int t_startY, int t_width, int t_height, int32_t t_chunk, std::vector<TileSpan>& t_spans) const;
+
+        /**
+         * @brief Checks whether any part of an area is visible on the screen.
+         *
+         * @param t_startX The world x position of the area.
+         * @param t_startY The world y position of the area.
+         * @param t_width The width of the area.
+         * @param t_height The height of the area.
+         *
+         * @return True if the area may contain visible positions. Otherwise, it returns false.
+         */
+        [[nodiscard]] bool IsAreaVisible(int t_startX, int t_startY, int t_width, int t_height) const;
+
+        /**
+         * @brief Calculates the bounds of the screen positions of an area without the camera offset.
+         *
+         * @param t_startX The world x position of the area.
+         * @param t_startY The world y position of the area.
+         * @param t_width The width of the area.
+         * @param t_height The height of the area.
+         * @param t_zoom The zoom.
+         * @param t_rotation The rotation.
+         *
+         * @return An Aabb containing the screen position of each tile.
+         */
+        [[nodiscard]] physics::Aabb CalcScreenAabb(int t_startX, int t_startY, int t_width, int t_height, Zoom t_zoom, Rotation t_rotation) const;
+
+        /**
+         * @brief Checks whether screen positions calculated with `CalcScreenAabb()` may be visible.
+         *
+         * @param t_aabb The bounds of the screen positions for the current zoom and rotation.
+         *
+         * @return True if there is an overlap with the screen; otherwise false.
+         */
+        [[nodiscard]] bool IsScreenAabbVisible(const physics::Aabb& t_aabb) const
+        {
+            return physics::Aabb::AabbVsAabb(t_aabb, m_screenAabb);
+        }
+
+    protected:
+
+    private:
+        //-------------------------------------------------
+        // Member
+        //-------------------------------------------------
+
+        /**
+         * @brief Pointer to the parent World object.
+         */
+        const World* m_world{ nullptr };
+
+        /**
+         * @brief The width of the window.
+         */
+        int m_windowWidth{ 0 };
+
+        /**
+         * @brief The height of the window.
+         */
+        int m_windowHeight{ 0 };
+
+        /**
+         * @brief The zoom used for the last update.
+         */
+        Zoom m_zoom{ Zoom::GFX };
+
+        /**
+         * @brief The rotation used for the last update.
+         */
+        Rotation m_rotation{ Rotation::DEG0 };
+
+        /**
+         * @brief The smallest visible `x - y` of a rotated world position.
+         */
+        int m_uMin{ 0 };
+
+        /**
+         * @brief The largest visible `x - y` of a rotated world position.
+         */
+        int m_uMax{ -1 };
+
+        /**
+         * @brief The smallest visible `x + y` of a rotated world position.
+         */
+        int m_vMin{ 0 };
+
+        /**
+         * @brief The largest visible `x + y` of a rotated world position.
+         */
+        int m_vMax{ -1 };
+
+        /**
+         * @brief The valid screen positions without the camera offset.
+         */
+        physics::Aabb m_screenAabb;
+
+        //-------------------------------------------------
+        // Helper
+        //-------------------------------------------------
+
+        /**
+         * @brief Describes an area in the render order of the current rotation.
+         */
+        struct RotatedArea
+        {
+            /**
+             * @brief `x - y` of the first position in the render order.
+             */
+            int uOffset{ 0 };
+
+            /**
+             * @brief `x + y` of the first position in the render order.
+             */
+            int vOffset{ 0 };
+
+            /**
+             * @brief The number of positions per row.
+             */
+            int rowLength{ 0 };
+
+            /**
+             * @brief The number of rows.
+             */
+            int rows{ 0 };
+        };
+
+        /**
+         * @brief Transforms an area of the world into the render order of a rotation.
+         *
+         * @param t_startX The world x position of the area.
+         * @param t_startY The world y position of the area.
+         * @param t_width The width of the area.
+         * @param t_height The height of the area.
+         * @param t_rotation The rotation.
+         *
+         * @return The rotated area.
+         */
+        [[nodiscard]] RotatedArea ToRotatedArea(int t_startX, int t_startY, int t_width, int t_height, Rotation t_rotation) const;
+
+        /**
+         * @brief Checks whether the u and v bounds of a rotated area overlap the visible area.
+         *
+         * @param t_area The rotated area.
+         *
+         * @return True if there is an overlap; otherwise false.
+         */
+        [[nodiscard]] bool Overlaps(const RotatedArea& t_area) const;
+
+        /**
+         * @brief Integer division rounding towards negative infinity.
+         */
+        [[nodiscard]] static int FloorDiv(int t_a, int t_b);
+
+        /**
+         * @brief Integer division rounding towards positive infinity.
+         */
+        [[nodiscard]] static int CeilDiv(int t_a, int t_b);
+    };
+}
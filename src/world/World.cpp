@@ -16,14 +16,23 @@
 // along with this program; if not, write to the Free Software
 // Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
 
+#include <algorithm>
 #include "World.h"
+#include "Profiler.h"
 #include "Island.h"
 #include "MousePicker.h"
+#include "Viewport.h"
+#include "OccupancyGrid.h"
 #include "DeepWater.h"
+#include "Population.h"
 #include "Gui.h"
 #include "resource/TileAtlas.h"
 #include "resource/AnimalsTileAtlas.h"
+#include "resource/AnimationClock.h"
 #include "renderer/Renderer.h"
+#include "renderer/DrawList.h"
+#include "renderer/RenderState.h"
+#include "job/JobSystem.h"
 
 //-------------------------------------------------
 // Ctors. / Dtor.
@@ -56,6 +65,12 @@ mdcii::world::World::World(state::State* t_state, const nlohmann::json& t_json)
 mdcii::world::World::~World() noexcept
 {
     MDCII_LOG_DEBUG("[World::~World()] Destruct World.");
+
+    // the imposter Jobs read the atlas images, which are destroyed before the islands
+    for (const auto& island : islands)
+    {
+        island->GetImposter()->WaitForJob();
+    }
 }
 
 //-------------------------------------------------
@@ -71,12 +86,24 @@ void mdcii::world::World::CreateCoreObjects()
         throw MDCII_EXCEPTION("[World::CreateCoreObjects()] Invalid world size.");
     }
 
+    // the deep water is rendered on all positions without an island
+    islandGrid = std::make_unique<OccupancyGrid>(worldWidth, worldHeight);
+    for (auto i{ 0 }; i < static_cast<int>(islands.size()); ++i)
+    {
+        const auto& island{ islands[i] };
+        islandGrid->AddIsland(i, island->startX, island->startY, island->width, island->height);
+    }
+
     deepWater = std::make_unique<DeepWater>(this);
+    population = std::make_unique<Population>(this);
     camera = std::make_unique<camera::Camera>(this);
+    viewport = std::make_unique<Viewport>(this);
     mousePicker = std::make_unique<MousePicker>(this, true);
 
     tileAtlas = std::make_unique<resource::TileAtlas>(this);
     animalsTileAtlas = std::make_unique<resource::AnimalsTileAtlas>(this);
+    drawList = std::make_unique<renderer::DrawList>(this);
+    renderState = std::make_unique<renderer::RenderState>();
 }
 
 //-------------------------------------------------
@@ -85,30 +112,74 @@ void mdcii::world::World::CreateCoreObjects()
 
 void mdcii::world::World::OnUserUpdate(const float t_elapsedTime)
 {
+    MDCII_PROFILE_SCOPE("World::OnUserUpdate");
+
     // first access
     if (m_flag)
     {
         MDCII_LOG_DEBUG("[World::OnUserUpdate()] First world update.");
 
-        MDCII_ASSERT(deepWater->layer->currentTiles.empty(), "[World::OnUserUpdate()] Invalid number of tiles.")
+        MDCII_ASSERT(deepWater->currentSpans.empty(), "[World::OnUserUpdate()] Invalid number of tiles.")
+    }
 
-        FindVisibleIslands();
-        FindVisibleDeepWaterTiles();
+    // the visible tiles are only searched again when the camera has moved to another tile or the zoom has changed
+    if (const auto cameraChanged{ camera->OnUserUpdate(t_elapsedTime) }; cameraChanged || m_flag)
+    {
+        UpdateVisibleArea();
+    }
+
+    m_flag = false;
 
-        m_flag = false;
+    // spawn animals
+    population->OnUserUpdate(t_elapsedTime);
+
+    // update animations; only the visible islands are rendered
+    resource::AnimationClock::Update(t_elapsedTime);
+    deepWater->UpdateAnimation();
+    for (auto* island : currentIslands)
+    {
+        island->UpdateAnimations();
     }
 
-    // on key pressed
-    if (camera->OnUserUpdate(t_elapsedTime) && !m_flag)
+    // render world; all draws are only created again when the visible tiles have changed,
+    // an island with changes on the screen only records its own draws again
+    m_changedIslands.clear();
+    for (auto i{ 0 }; i < static_cast<int>(currentIslands.size()); ++i)
     {
-        FindVisibleIslands();
-        FindVisibleDeepWaterTiles();
+        if (currentIslands[i]->HasVisibleChanges())
+        {
+            m_changedIslands.push_back(i);
+        }
     }
 
-    // render world
-    HasRenderLayerOption(RenderLayer::RENDER_ALL) ?
-        renderer::Renderer::RenderWorld(this, t_elapsedTime) :     // should be used in the release
-        renderer::Renderer::RenderWorldParts(this, t_elapsedTime); // ability to switch layers on and off
+    for (const auto& island : islands)
+    {
+        if (island->HasChanges())
+        {
+            m_rebuildDraws |= island->HasMoved();
+            island->ClearChanges();
+        }
+    }
+
+    // the imposter images are created in the background; a finished image requires new draws
+    if (UseIslandImposters())
+    {
+        for (auto i{ 0 }; i < static_cast<int>(currentIslands.size()); ++i)
+        {
+            if (currentIslands[i]->GetImposter()->Update() && std::ranges::find(m_changedIslands, i) == m_changedIslands.end())
+            {
+                m_changedIslands.push_back(i);
+            }
+        }
+    }
+
+    if (!m_rebuildDraws && !m_changedIslands.empty())
+    {
+        renderer::Renderer::RenderChangedIslands(this, m_changedIslands);
+    }
+
+    renderer::Renderer::Render(this, m_rebuildDraws);
+    m_rebuildDraws = false;
 
     // update current island && tiles
     SetCurrentIslandUnderMouse();
@@ -121,6 +192,7 @@ void mdcii::world::World::OnUserUpdate(const float t_elapsedTime)
     // do nothing (return) when the mouse is over the ImGui window
     if (ImGui::GetIO().WantCaptureMouse)
     {
+        drawList->Submit();
         return;
     }
 
@@ -158,6 +230,8 @@ void mdcii::world::World::OnUserUpdate(const float t_elapsedTime)
         }
     }
 
+    drawList->Submit();
+
     mousePicker->OnUserUpdate();
 }
 
@@ -173,8 +247,7 @@ void mdcii::world::World::RenderImGui()
 
     if (camera->RenderImGui())
     {
-        FindVisibleIslands();
-        FindVisibleDeepWaterTiles();
+        UpdateVisibleArea();
     }
 
     ImGui::Begin("Tiles");
@@ -207,6 +280,8 @@ void mdcii::world::World::RenderImGui()
 
     ImGui::End();
 
+    MDCII_PROFILE_RENDER_IMGUI();
+
     mousePicker->RenderImGui();
 
     static auto renderCoastLayer{ false };
@@ -217,9 +292,16 @@ void mdcii::world::World::RenderImGui()
     static auto renderFiguresLayer{ false };
 
     static auto renderAll{ true };
+    static auto renderIslandImposters{ true };
 
-    ImGui::Checkbox("Render islands terrain grid", &renderIslandsGrid);
-    ImGui::Checkbox("Render deep water grid", &renderDeepWaterGrid);
+    if (ImGui::Checkbox("Render islands terrain grid", &renderIslandsGrid))
+    {
+        m_rebuildDraws = true;
+    }
+    if (ImGui::Checkbox("Render deep water grid", &renderDeepWaterGrid))
+    {
+        m_rebuildDraws = true;
+    }
 
     ImGui::Separator();
 
@@ -290,12 +372,34 @@ void mdcii::world::World::RenderImGui()
         FindVisibleIslands();
         FindVisibleDeepWaterTiles();
     }
+    if (ImGui::Checkbox("Use Island Imposters", &renderIslandImposters))
+    {
+        ToggleRenderLayer(RENDER_ISLAND_IMPOSTERS);
+    }
 
     ImGui::Separator();
 
     Gui::RenderAddBuildingsGui(state->game);
 }
 
+//-------------------------------------------------
+// Visible area
+//-------------------------------------------------
+
+bool mdcii::world::World::UpdateVisibleArea()
+{
+    if (!viewport->Update())
+    {
+        return false;
+    }
+
+    FindVisibleIslands();
+    FindVisibleDeepWaterTiles();
+    m_rebuildDraws = true;
+
+    return true;
+}
+
 //-------------------------------------------------
 // World / screen positions
 //-------------------------------------------------
@@ -312,28 +416,24 @@ olc::vi2d mdcii::world::World::ToScreen(const int t_x, const int t_y) const
 
 bool mdcii::world::World::IsWorldPositionOverAnyIsland(const int t_x, const int t_y) const
 {
-    return std::ranges::any_of(islands, [t_x, t_y](auto const& t_island)
-    {
-        return t_island->IsWorldPositionOverIsland({ t_x, t_y });
-    });
+    return islandGrid->GetIslandIndex(t_x, t_y) != OccupancyGrid::NO_ISLAND;
 }
 
-void mdcii::world::World::SetCurrentIslandUnderMouse()
+mdcii::world::Island* mdcii::world::World::GetIslandAt(const int t_x, const int t_y) const
 {
-    CurrentIsland currentIsland{};
-
-    for (const auto& island : currentIslands)
+    if (const auto index{ islandGrid->GetIslandIndex(t_x, t_y) }; index != OccupancyGrid::NO_ISLAND)
     {
-        if (const auto mouseOverIsland{ island->IsMouseOverIsland() }; mouseOverIsland.has_value())
-        {
-            currentIsland = { island, mouseOverIsland.value() };
-            break;
-        }
+        return islands[index].get();
     }
 
-    if (currentIsland.island)
+    return nullptr;
+}
+
+void mdcii::world::World::SetCurrentIslandUnderMouse()
+{
+    if (auto* island{ GetIslandAt(mousePicker->selected.x, mousePicker->selected.y) }; island)
     {
-        m_currentIslandUnderMouse = currentIsland;
+        m_currentIslandUnderMouse = { island, olc::vi2d(mousePicker->selected.x - island->startX, mousePicker->selected.y - island->startY) };
     }
 }
 
@@ -344,11 +444,11 @@ void mdcii::world::World::SetCurrentTilesUnderMouse()
 
     if (m_currentIslandUnderMouse.island)
     {
-        auto& terrainTile{ m_currentIslandUnderMouse.island->GetTerrainLayer(layer::LayerType::TERRAIN)->GetSortedTile(
-                m_currentIslandUnderMouse.position.x, m_currentIslandUnderMouse.position.y, camera->rotation) };
+        auto& terrainTile{ m_currentIslandUnderMouse.island->GetTerrainLayer(layer::LayerType::TERRAIN)->GetTile(
+                m_currentIslandUnderMouse.position.x, m_currentIslandUnderMouse.position.y) };
 
-        auto& buildingTile{ m_currentIslandUnderMouse.island->GetTerrainLayer(layer::LayerType::BUILDINGS)->GetSortedTile(
-                m_currentIslandUnderMouse.position.x, m_currentIslandUnderMouse.position.y, camera->rotation) };
+        auto& buildingTile{ m_currentIslandUnderMouse.island->GetTerrainLayer(layer::LayerType::BUILDINGS)->GetTile(
+                m_currentIslandUnderMouse.position.x, m_currentIslandUnderMouse.position.y) };
 
         if (terrainTile.HasBuilding())
         {
@@ -364,11 +464,7 @@ void mdcii::world::World::SetCurrentTilesUnderMouse()
 
 bool mdcii::world::World::IsWorldPositionOutsideScreen(const int t_x, const int t_y) const
 {
-    const auto screenPosition{ ToScreen(t_x, t_y) };
-    return screenPosition.x > Game::INI.Get<int>("window", "width") + get_tile_width(camera->zoom) ||
-           screenPosition.x < -get_tile_width_half(camera->zoom) ||
-           screenPosition.y > Game::INI.Get<int>("window", "height") + get_tile_height(camera->zoom) ||
-           screenPosition.y < -get_tile_height_half(camera->zoom);
+    return !viewport->IsWorldPositionVisible(t_x, t_y);
 }
 
 //-------------------------------------------------
@@ -406,67 +502,73 @@ void mdcii::world::World::Init(const nlohmann::json& t_json)
 // Render helper
 //-------------------------------------------------
 
-void mdcii::world::World::AddIslandToRenderList(Island* t_island)
+bool mdcii::world::World::UpdateCurrentIslandTiles(Island* t_island) const
 {
-    currentIslands.insert(t_island);
-}
+    // the layers of an island outside the screen are not needed
+    if (!viewport->IsAreaVisible(t_island->startX, t_island->startY, t_island->width, t_island->height))
+    {
+        MDCII_PROFILE_COUNTER("Tiles culled", t_island->width * t_island->height);
+        return false;
+    }
 
-void mdcii::world::World::FindVisibleIslands()
-{
-    currentIslands.clear();
+    auto visible{ false };
 
-    for (const auto& island : islands)
+    if (HasRenderLayerOption(RenderLayer::RENDER_FIGURES_LAYER))
     {
-        if (HasRenderLayerOption(RenderLayer::RENDER_FIGURES_LAYER))
+        visible |= t_island->GetFiguresLayer()->UpdateCurrentTiles(t_island->startX, t_island->startY);
+    }
+
+    if (HasRenderLayerOption(RenderLayer::RENDER_MIXED_LAYER))
+    {
+        visible |= t_island->GetMixedLayer()->UpdateCurrentTiles(t_island->startX, t_island->startY);
+    }
+    else if (HasRenderLayerOption(RenderLayer::RENDER_COAST_LAYER) ||
+             HasRenderLayerOption(RenderLayer::RENDER_TERRAIN_LAYER) ||
+             HasRenderLayerOption(RenderLayer::RENDER_BUILDINGS_LAYER))
+    {
+        if (HasRenderLayerOption(RenderLayer::RENDER_COAST_LAYER))
         {
-            if (island->GetFiguresLayer()->UpdateCurrentTiles(island->startX, island->startY))
-            {
-                AddIslandToRenderList(island.get());
-            }
+            visible |= t_island->GetTerrainLayer(layer::LayerType::COAST)->UpdateCurrentTiles(t_island->startX, t_island->startY);
         }
-
-        if (HasRenderLayerOption(RenderLayer::RENDER_MIXED_LAYER))
+        if (HasRenderLayerOption(RenderLayer::RENDER_TERRAIN_LAYER))
         {
-            if (island->GetTerrainLayer(layer::LayerType::MIXED)->UpdateCurrentTiles(island->startX, island->startY))
-            {
-                AddIslandToRenderList(island.get());
-            }
+            visible |= t_island->GetTerrainLayer(layer::LayerType::TERRAIN)->UpdateCurrentTiles(t_island->startX, t_island->startY);
         }
-        else if (HasRenderLayerOption(RenderLayer::RENDER_COAST_LAYER) ||
-                 HasRenderLayerOption(RenderLayer::RENDER_TERRAIN_LAYER) ||
-                 HasRenderLayerOption(RenderLayer::RENDER_BUILDINGS_LAYER))
+        if (HasRenderLayerOption(RenderLayer::RENDER_BUILDINGS_LAYER))
         {
-            if (HasRenderLayerOption(RenderLayer::RENDER_COAST_LAYER))
-            {
-                if (island->GetTerrainLayer(layer::LayerType::COAST)->UpdateCurrentTiles(island->startX, island->startY))
-                {
-                    AddIslandToRenderList(island.get());
-                }
-            }
-            if (HasRenderLayerOption(RenderLayer::RENDER_TERRAIN_LAYER))
-            {
-                if (island->GetTerrainLayer(layer::LayerType::TERRAIN)->UpdateCurrentTiles(island->startX, island->startY))
-                {
-                    AddIslandToRenderList(island.get());
-                }
-            }
-            if (HasRenderLayerOption(RenderLayer::RENDER_BUILDINGS_LAYER))
-            {
-                if (island->GetTerrainLayer(layer::LayerType::BUILDINGS)->UpdateCurrentTiles(island->startX, island->startY))
-                {
-                    AddIslandToRenderList(island.get());
-                }
-            }
+            visible |= t_island->GetTerrainLayer(layer::LayerType::BUILDINGS)->UpdateCurrentTiles(t_island->startX, t_island->startY);
         }
+    }
+
+    if (HasRenderLayerOption(RenderLayer::RENDER_ALL))
+    {
+        const auto f{ t_island->GetFiguresLayer()->UpdateCurrentTiles(t_island->startX, t_island->startY) };
+        const auto m{ t_island->GetMixedLayer()->UpdateCurrentTiles(t_island->startX, t_island->startY) };
+        visible |= f || m;
+    }
 
-        if (HasRenderLayerOption(RenderLayer::RENDER_ALL))
+    return visible;
+}
+
+void mdcii::world::World::FindVisibleIslands()
+{
+    MDCII_PROFILE_SCOPE("World::FindVisibleIslands");
+
+    const auto nrOfIslands{ static_cast<int>(islands.size()) };
+
+    // a byte for each island, as the workers must not share the bits of a std::vector<bool>
+    std::vector<uint8_t> visible(nrOfIslands, 0);
+    state->game->jobSystem->ParallelFor(nrOfIslands, [&](const int t_index)
+    {
+        visible[t_index] = UpdateCurrentIslandTiles(islands[t_index].get());
+    });
+
+    currentIslands.clear();
+    for (auto i{ 0 }; i < nrOfIslands; ++i)
+    {
+        if (visible[i])
         {
-            const auto f{ island->GetFiguresLayer()->UpdateCurrentTiles(island->startX, island->startY) };
-            const auto m{ island->GetTerrainLayer(layer::LayerType::MIXED)->UpdateCurrentTiles(island->startX, island->startY) };
-            if (f || m)
-            {
-                AddIslandToRenderList(island.get());
-            }
+            currentIslands.push_back(islands[i].get());
         }
     }
 
@@ -475,9 +577,9 @@ void mdcii::world::World::FindVisibleIslands()
 
 void mdcii::world::World::FindVisibleDeepWaterTiles() const
 {
-    deepWater->layer->UpdateCurrentTiles(0, 0);
+    deepWater->UpdateCurrentSpans();
 
-    MDCII_LOG_DEBUG("[World::FindVisibleDeepWaterTiles()] Render {} deep water tiles.", deepWater->layer->currentTiles.size());
+    MDCII_LOG_DEBUG("[World::FindVisibleDeepWaterTiles()] Render {} deep water ranges.", deepWater->currentSpans.size());
 }
 
 //-------------------------------------------------
@@ -487,12 +589,14 @@ void mdcii::world::World::FindVisibleDeepWaterTiles() const
 void mdcii::world::World::ToggleRenderLayer(const RenderLayer t_renderLayer)
 {
     renderLayer ^= t_renderLayer;
+    m_rebuildDraws = true;
 }
 
 void mdcii::world::World::DisableRenderLayer(const RenderLayer t_renderLayer, bool& t_toFalse)
 {
     renderLayer &= ~t_renderLayer;
     t_toFalse = false;
+    m_rebuildDraws = true;
 }
 
 //-------------------------------------------------
@@ -18,7 +18,7 @@
 
 #pragma once
 
-#include <unordered_set>
+#include <vector>
 #include "vendor/olc/olcPixelGameEngine.h"
 #include "vendor/nlohmann/json.hpp"
 
@@ -42,6 +42,19 @@ namespace mdcii::camera
     class Camera;
 }
 
+namespace mdcii::renderer
+{
+    /**
+     * @brief Forward declaration class DrawList.
+     */
+    class DrawList;
+
+    /**
+     * @brief Forward declaration struct RenderState.
+     */
+    struct RenderState;
+}
+
 namespace mdcii::resource
 {
     /**
@@ -88,6 +101,21 @@ namespace mdcii::world
      */
     class MousePicker;
 
+    /**
+     * @brief Forward declaration class Viewport.
+     */
+    class Viewport;
+
+    /**
+     * @brief Forward declaration class OccupancyGrid.
+     */
+    class OccupancyGrid;
+
+    /**
+     * @brief Forward declaration class Population.
+     */
+    class Population;
+
     //-------------------------------------------------
     // Render layer options
     //-------------------------------------------------
@@ -103,7 +131,8 @@ namespace mdcii::world
         RENDER_FIGURES_LAYER = 8,
         RENDER_MIXED_LAYER = 16,
         RENDER_DEEP_WATER_LAYER = 32,
-        RENDER_ALL = 64
+        RENDER_ALL = 64,
+        RENDER_ISLAND_IMPOSTERS = 128
     };
 
     //-------------------------------------------------
@@ -177,20 +206,35 @@ namespace mdcii::world
         std::vector<std::unique_ptr<Island>> islands;
 
         /**
-         * @brief Pointer to the Islands objects that are currently being rendered.
+         * @brief Pointer to the Islands objects that are currently being rendered, in the order of `islands`.
          */
-        std::unordered_set<Island*> currentIslands;
+        std::vector<Island*> currentIslands;
+
+        /**
+         * @brief The index of the island covering each world position.
+         */
+        std::unique_ptr<OccupancyGrid> islandGrid;
 
         /**
          * @brief Pointer to the DeepWater object.
          */
         std::unique_ptr<DeepWater> deepWater;
 
+        /**
+         * @brief Spawns the animals on the islands.
+         */
+        std::unique_ptr<Population> population;
+
         /**
          * @brief A camera to move around.
          */
         std::unique_ptr<camera::Camera> camera;
 
+        /**
+         * @brief Determines the visible area of the camera.
+         */
+        std::unique_ptr<Viewport> viewport;
+
         /**
          * @brief Pointer to the MousePicker object.
          */
@@ -206,6 +250,16 @@ namespace mdcii::world
          */
         std::unique_ptr<resource::AnimalsTileAtlas> animalsTileAtlas;
 
+        /**
+         * @brief Pointer to the DrawList object collecting the tiles of a frame.
+         */
+        std::unique_ptr<renderer::DrawList> drawList;
+
+        /**
+         * @brief Pointer to the RenderState object with the render data kept between the frames.
+         */
+        std::unique_ptr<renderer::RenderState> renderState;
+
         /**
          * @brief Renders a grid on the deep water.
          */
@@ -219,7 +273,7 @@ namespace mdcii::world
         /**
          * @brief Representing the currently selected layers for rendering in the game world.
          */
-        int renderLayer{ RENDER_ALL };
+        int renderLayer{ RENDER_ALL | RENDER_ISLAND_IMPOSTERS };
 
         //-------------------------------------------------
         // Ctors. / Dtor.
@@ -272,6 +326,17 @@ namespace mdcii::world
 
         void RenderImGui();
 
+        //-------------------------------------------------
+        // Visible area
+        //-------------------------------------------------
+
+        /**
+         * @brief Searches the visible islands and deep water tiles again if the visible area of the camera has changed.
+         *
+         * @return True if the visible area has changed; otherwise false.
+         */
+        bool UpdateVisibleArea();
+
         //-------------------------------------------------
         // World / screen positions
         //-------------------------------------------------
@@ -296,6 +361,16 @@ namespace mdcii::world
          */
         [[nodiscard]] bool IsWorldPositionOverAnyIsland(int t_x, int t_y) const;
 
+        /**
+         * @brief Determines the island covering the given world position.
+         *
+         * @param t_x The x position.
+         * @param t_y The y position.
+         *
+         * @return Pointer to the Island object or nullptr if the position is not over an island.
+         */
+        [[nodiscard]] Island* GetIslandAt(int t_x, int t_y) const;
+
         /**
          * @brief Determines the current island under the mouse.
          */
@@ -329,6 +404,16 @@ namespace mdcii::world
          */
         [[nodiscard]] bool HasRenderLayerOption(RenderLayer t_option) const { return (renderLayer & t_option) != 0; }
 
+        /**
+         * @brief Checks whether the static tiles of the islands are rendered from the imposter images.
+         *
+         * @return True if the imposter images are used, false otherwise.
+         */
+        [[nodiscard]] bool UseIslandImposters() const
+        {
+            return HasRenderLayerOption(RENDER_ALL) && HasRenderLayerOption(RENDER_ISLAND_IMPOSTERS) && !renderIslandsGrid;
+        }
+
     protected:
 
     private:
@@ -341,6 +426,16 @@ namespace mdcii::world
          */
         bool m_flag{ true };
 
+        /**
+         * @brief True if the retained draws of the DrawList must be created again.
+         */
+        bool m_rebuildDraws{ true };
+
+        /**
+         * @brief The indices of the visible islands whose draws must be created again.
+         */
+        std::vector<int> m_changedIslands;
+
         /**
          * @brief The current island under the mouse.
          */
@@ -367,14 +462,18 @@ namespace mdcii::world
         //-------------------------------------------------
 
         /**
-         * @brief Adds the given island to the render list.
+         * @brief Sets the visible tiles of the island layers required by the render layer options.
+         *
+         * @param t_island The island to be updated.
          *
-         * @param t_island The island to be added to the render list.
+         * @return True if the island has visible tiles; otherwise false.
          */
-        void AddIslandToRenderList(Island* t_island);
+        [[nodiscard]] bool UpdateCurrentIslandTiles(Island* t_island) const;
 
         /**
          * @brief Identifies the islands visible on the screen for rendering.
+         *
+         * The islands are independent, so they are updated in parallel.
          */
         void FindVisibleIslands();
 
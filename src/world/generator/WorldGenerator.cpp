@@ -20,6 +20,7 @@
 #include "MdciiUtils.h"
 #include "world/Island.h"
 #include "world/MousePicker.h"
+#include "world/OccupancyGrid.h"
 #include "resource/MdciiResourcesManager.h"
 
 //-------------------------------------------------
@@ -50,12 +51,18 @@ void mdcii::world::generator::WorldGenerator::OnUserUpdate(const float t_elapsed
     // FindVisibleIslands();
     if (m_currentIsland)
     {
-        m_currentIsland->startX = world->mousePicker->selected.x;
-        m_currentIsland->startY = world->mousePicker->selected.y;
+        m_currentIsland->SetPosition(world->mousePicker->selected.x, world->mousePicker->selected.y);
     }
 
-    if (world->state->game->GetMouse(0).bPressed && m_currentIsland)
+    // the island can only be placed on free positions within the world
+    if (world->state->game->GetMouse(0).bPressed && m_currentIsland &&
+        world->islandGrid->IsAreaFree(m_currentIsland->startX, m_currentIsland->startY, m_currentIsland->width, m_currentIsland->height))
     {
+        world->islandGrid->AddIsland(
+            static_cast<int32_t>(world->islands.size()) - 1,
+            m_currentIsland->startX, m_currentIsland->startY,
+            m_currentIsland->width, m_currentIsland->height
+        );
         m_currentIsland = nullptr;
     }
 
@@ -74,8 +81,7 @@ void mdcii::world::generator::WorldGenerator::OnUserUpdate(const float t_elapsed
         if (fileName.SetJsonFromFile())
         {
             auto island{ std::make_unique<Island>(world.get(), fileName.GetJson()) };
-            island->startX = 0;
-            island->startY = 0;
+            island->SetPosition(0, 0);
 
             world->islands.push_back(std::move(island));
             m_currentIsland = world->islands.back().get();
@@ -18,14 +18,21 @@
 
 #pragma once
 
+#include <optional>
+#include <algorithm>
 #include "MdciiAssert.h"
+#include "Profiler.h"
 #include "Game.h"
 #include "world/tile/TerrainTile.h"
 #include "world/tile/FigureTile.h"
+#include "world/layer/LayerChunk.h"
 #include "world/Rotation.h"
+#include "world/RenderOrder.h"
+#include "world/Viewport.h"
 #include "world/World.h"
 #include "state/State.h"
 #include "resource/OriginalResourcesManager.h"
+#include "resource/AnimationClock.h"
 #include "camera/Camera.h"
 
 namespace mdcii::world::layer
@@ -58,6 +65,20 @@ namespace mdcii::world::layer
         COAST, TERRAIN, BUILDINGS, FIGURES, MIXED, DEEP_WATER, NONE
     };
 
+    //-------------------------------------------------
+    // AnimatedTile
+    //-------------------------------------------------
+
+    /**
+     * @brief Refers to a tile whose frame is counted up by an animation clock.
+     */
+    struct AnimatedTile
+    {
+        int32_t tileIndex{ -1 };
+        int16_t clock{ resource::AnimationClock::NO_CLOCK };
+        int16_t animAnz{ 1 };
+    };
+
     //-------------------------------------------------
     // Layer
     //-------------------------------------------------
@@ -96,24 +117,24 @@ namespace mdcii::world::layer
         const World* world{ nullptr };
 
         /**
-         * @brief Contains all tiles of the layer, sorted as in rotation DEG0.
+         * @brief Contains all tiles of the layer, stored chunk by chunk.
          */
         std::vector<T> tiles;
 
         /**
-         * @brief Contains the tiles for each rotation in the correct order for rendering.
+         * @brief The chunks of the layer, row by row.
          */
-        std::array<std::vector<T>, magic_enum::enum_count<Rotation>()> sortedTiles;
+        std::vector<LayerChunk> chunks;
 
         /**
-         * @brief To get the correct position of a tile in `sortedTiles` from rotation and render index.
+         * @brief The ranges of the chunks in render order that are on the screen.
          */
-        std::array<std::map<int, int>, magic_enum::enum_count<Rotation>()> sortedIndices;
+        std::vector<TileSpan> currentSpans;
 
         /**
-         * @brief The tiles that are currently being rendered.
+         * @brief The indices of the chunks with changed tiles since the last `ClearDirtyChunks()`.
          */
-        std::vector<T> currentTiles;
+        std::vector<int32_t> dirtyChunks;
 
         //-------------------------------------------------
         // Ctors. / Dtor.
@@ -138,6 +159,8 @@ namespace mdcii::world::layer
             MDCII_ASSERT(width > 0, "[Layer::Layer()] Invalid width given.")
             MDCII_ASSERT(height > 0, "[Layer::Layer()] Invalid height given.")
             MDCII_ASSERT(world, "[Layer::Layer()] Null pointer.")
+
+            InitChunks();
         }
 
         Layer(const Layer& t_other) = delete;
@@ -151,23 +174,60 @@ namespace mdcii::world::layer
         // Getter
         //-------------------------------------------------
 
-        [[nodiscard]] int GetSortedIndex(const int t_x, const int t_y, const Rotation t_rotation)
+        /**
+         * @brief Determines the index of the chunk containing a position.
+         *
+         * @param t_x The x position on the layer.
+         * @param t_y The y position on the layer.
+         *
+         * @return The index into `chunks`.
+         */
+        [[nodiscard]] int GetChunkIndex(const int t_x, const int t_y) const
         {
-            return sortedIndices.at(magic_enum::enum_integer(t_rotation)).at(tile::Tile::GetRenderIndex(t_x, t_y, width, height, t_rotation));
+            MDCII_ASSERT(t_x >= 0 && t_x < width && t_y >= 0 && t_y < height, "[Layer::GetChunkIndex()] Invalid position given.")
+
+            return (t_y / LayerChunk::SIZE) * m_chunksX + t_x / LayerChunk::SIZE;
         }
 
         /**
-         * @brief Retrieves a reference to a tile at the specified position and rotation from `sortedTiles`.
+         * @brief Determines the index of the tile at a position.
+         *
+         * @param t_x The x position on the layer.
+         * @param t_y The y position on the layer.
+         *
+         * @return The index into `tiles`.
+         */
+        [[nodiscard]] int GetTileIndex(const int t_x, const int t_y) const
+        {
+            const auto& chunk{ chunks[GetChunkIndex(t_x, t_y)] };
+
+            return chunk.begin + (t_y - chunk.y) * chunk.width + (t_x - chunk.x);
+        }
+
+        /**
+         * @brief Retrieves a reference to a tile at the specified position.
          *
          * @param t_x The x position on the layer.
          * @param t_y The y position on the layer.
-         * @param t_rotation The rotation for the search.
          *
          * @return A reference to the tile.
          */
-        [[nodiscard]] T& GetSortedTile(const int t_x, const int t_y, const Rotation t_rotation)
+        [[nodiscard]] T& GetTile(const int t_x, const int t_y)
+        {
+            return tiles[GetTileIndex(t_x, t_y)];
+        }
+
+        /**
+         * @brief Retrieves a const reference to a tile at the specified position.
+         *
+         * @param t_x The x position on the layer.
+         * @param t_y The y position on the layer.
+         *
+         * @return A const reference to the tile.
+         */
+        [[nodiscard]] const T& GetTile(const int t_x, const int t_y) const
         {
-            return sortedTiles.at(magic_enum::enum_integer(t_rotation)).at(GetSortedIndex(t_x, t_y, t_rotation));
+            return tiles[GetTileIndex(t_x, t_y)];
         }
 
         //-------------------------------------------------
@@ -205,6 +265,11 @@ namespace mdcii::world::layer
          */
         virtual void PostTileAdd(T& t_tile) {};
 
+        /**
+         * Does stuff after all tiles of an `AddTile()` or `AddTiles()` call were added to the layer.
+         */
+        virtual void PostTilesAdd() {};
+
         //-------------------------------------------------
         // Create and init tiles from Json
         //-------------------------------------------------
@@ -218,13 +283,18 @@ namespace mdcii::world::layer
         {
             MDCII_LOG_DEBUG("[Layer::CreateTiles()] Start creating tiles for layer of type {} ...", magic_enum::enum_name(layerType));
 
+            MDCII_ASSERT(t_json.size() == width * static_cast<size_t>(height), "[Layer::CreateTiles()] Invalid number of tiles.")
+
+            tiles.resize(t_json.size());
+
+            // the Json value contains the tiles row by row
+            auto i{ 0 };
             for (const auto& [k, tileJson] : t_json.items())
             {
-                tiles.emplace_back(CreateTileFromJson(tileJson));
+                tiles[GetTileIndex(i % width, i / width)] = CreateTileFromJson(tileJson);
+                i++;
             }
 
-            MDCII_ASSERT(tiles.size() == width * static_cast<size_t>(height), "[Layer::CreateTiles()] Invalid number of tiles.")
-
             MDCII_LOG_DEBUG("[Layer::CreateTiles()] The tiles were created successfully.");
         }
 
@@ -246,54 +316,13 @@ namespace mdcii::world::layer
             }
 
             AddTileNeighbors();
-            SortTilesForRendering();
+
+            // e.g. the traffic tiles recorded by InitTile()
+            PostTilesAdd();
 
             MDCII_LOG_DEBUG("[Layer::InitTiles()] The tiles were initialized successfully.");
         };
 
-        //-------------------------------------------------
-        // Sort tiles
-        //-------------------------------------------------
-
-        /**
-         * @brief Sorts the tiles for correct rendering order.
-         *
-         * The sorted tiles are stored in `sortedTiles`.
-         */
-        void SortTilesForRendering()
-        {
-            MDCII_LOG_DEBUG("[Layer::SortTilesForRendering()] Start sorting tiles for rendering ...");
-
-            for (const auto rotation : magic_enum::enum_values<Rotation>())
-            {
-                const auto rotationInt{ magic_enum::enum_integer(rotation) };
-
-                MDCII_LOG_DEBUG("[Layer::SortTilesForRendering()] Sort for rotation: {}", magic_enum::enum_name(rotation));
-
-                // sort tiles by index
-                std::ranges::sort(tiles, [&](const T& t_a, const T& t_b)
-                {
-                    return t_a.renderIndices[rotationInt] < t_b.renderIndices[rotationInt];
-                });
-
-                // copy sorted tiles
-                sortedTiles.at(rotationInt) = tiles;
-
-                // the render-index can be negative; saves where the new index (i) can be found in sortedTiles
-                auto i{ 0 };
-                for (const auto& t : sortedTiles.at(rotationInt))
-                {
-                    sortedIndices.at(rotationInt).emplace(t.renderIndices.at(rotationInt), i);
-                    i++;
-                }
-            }
-
-            // revert tiles sorting = sortedTiles DEG0
-            tiles = sortedTiles.at(magic_enum::enum_integer(Rotation::DEG0));
-
-            MDCII_LOG_DEBUG("[Layer::SortTilesForRendering()] The tiles were sorted successfully.");
-        }
-
         //-------------------------------------------------
         // Neighbors
         //-------------------------------------------------
@@ -309,26 +338,26 @@ namespace mdcii::world::layer
             {
                 for (auto x{ 0 }; x < width; ++x)
                 {
-                    const auto i{ y * width + x };
+                    auto& tile{ GetTile(x, y) };
 
                     if (y > 0)
                     {
-                        tiles.at(i).n = (y - 1) * width + x;
+                        tile.n = GetTileIndex(x, y - 1);
                     }
 
                     if (y < height - 1)
                     {
-                        tiles.at(i).s = (y + 1) * width + x;
+                        tile.s = GetTileIndex(x, y + 1);
                     }
 
                     if (x > 0)
                     {
-                        tiles.at(i).w = y * width + (x - 1);
+                        tile.w = GetTileIndex(x - 1, y);
                     }
 
                     if (x < width - 1)
                     {
-                        tiles.at(i).e = y * width + (x + 1);
+                        tile.e = GetTileIndex(x + 1, y);
                     }
                 }
             }
@@ -336,69 +365,141 @@ namespace mdcii::world::layer
             MDCII_LOG_DEBUG("[Layer::AddTileNeighbors()] The neighbors have been saved successfully.");
         }
 
+        //-------------------------------------------------
+        // Current tiles to render
+        //-------------------------------------------------
+
         /**
-         * @brief Determines a 8-bit int from the neighbors indices.
+         * @brief Set `currentSpans` with the ranges of the visible tiles.
          *
-         * @param t_tile The tile with the neighbors indices.
+         * @param t_xOffset The world x position of the layer.
+         * @param t_yOffset The world y position of the layer.
          *
-         * @return A 8-bit flag.
+         * @return True if visible tiles were found; false otherwise.
          */
-        [[nodiscard]] uint8_t CalcNeighborFlag(const T& t_tile)
+        bool UpdateCurrentTiles(const int t_xOffset, const int t_yOffset)
         {
-            uint8_t neighborFlag{ 0 };
+            CalcCurrentSpans(t_xOffset, t_yOffset, currentSpans);
 
-            if (t_tile.n >= 0 && sortedTiles.at(magic_enum::enum_integer(world->camera->rotation)).at(t_tile.n).type == tile::Tile::TileType::TRAFFIC)
+            MDCII_LOG_DEBUG("[Layer::UpdateCurrentTiles()] Found {} visible ranges for layer {}.",
+                currentSpans.size(),
+                magic_enum::enum_name(layerType)
+            );
+
+            return !currentSpans.empty();
+        }
+
+        /**
+         * @brief Calculates the ranges of the visible tiles.
+         *
+         * Chunks outside the screen are rejected by their bounds.
+         *
+         * @param t_xOffset The world x position of the layer.
+         * @param t_yOffset The world y position of the layer.
+         * @param t_spans Receives the ranges of the chunks in render order.
+         */
+        void CalcCurrentSpans(const int t_xOffset, const int t_yOffset, std::vector<TileSpan>& t_spans)
+        {
+            if (const olc::vi2d offset{ t_xOffset, t_yOffset }; !m_chunkBoundsOffset.has_value() || m_chunkBoundsOffset.value() != offset)
             {
-                neighborFlag = tile::Tile::NORTH;
+                CalcChunkBounds(offset);
             }
 
-            if (t_tile.e >= 0 && sortedTiles.at(magic_enum::enum_integer(world->camera->rotation)).at(t_tile.e).type == tile::Tile::TileType::TRAFFIC)
+            t_spans.clear();
+
+            const auto rotation{ world->camera->rotation };
+            const auto zoomInt{ magic_enum::enum_integer(world->camera->zoom) };
+            const auto rotationInt{ magic_enum::enum_integer(rotation) };
+
+            // the chunks in render order
+            [[maybe_unused]] auto culledTiles{ 0 };
+            for (auto k{ 0 }; k < static_cast<int>(chunks.size()); ++k)
             {
-                neighborFlag |= tile::Tile::EAST;
+                const auto chunkPosition{ get_map_position(k, m_chunksX, m_chunksY, rotation) };
+                const auto chunkIndex{ chunkPosition.y * m_chunksX + chunkPosition.x };
+                const auto& chunk{ chunks[chunkIndex] };
+
+                if (world->viewport->IsScreenAabbVisible(chunk.screenAabbs[zoomInt][rotationInt]))
+                {
+                    world->viewport->CalcVisibleSpans(t_xOffset + chunk.x, t_yOffset + chunk.y, chunk.width, chunk.height, chunkIndex, t_spans);
+                }
+                else
+                {
+                    culledTiles += chunk.width * chunk.height;
+                }
             }
 
-            if (t_tile.s >= 0 && sortedTiles.at(magic_enum::enum_integer(world->camera->rotation)).at(t_tile.s).type == tile::Tile::TileType::TRAFFIC)
+            // the counter takes the lock of the Profiler, so it is only added once per layer
+            if (culledTiles > 0)
             {
-                neighborFlag |= tile::Tile::SOUTH;
+                MDCII_PROFILE_COUNTER("Tiles culled", culledTiles);
             }
+        }
 
-            if (t_tile.w >= 0 && sortedTiles.at(magic_enum::enum_integer(world->camera->rotation)).at(t_tile.w).type == tile::Tile::TileType::TRAFFIC)
+        /**
+         * @brief Calls a function for the index of each chunk in render order, visible or not.
+         *
+         * @param t_func The function to call with the index of the chunk in `chunks`.
+         */
+        template <typename F>
+        void ForEachChunkIndex(F&& t_func) const
+        {
+            const auto rotation{ world->camera->rotation };
+
+            for (auto k{ 0 }; k < static_cast<int>(chunks.size()); ++k)
             {
-                neighborFlag |= tile::Tile::WEST;
+                const auto chunkPosition{ get_map_position(k, m_chunksX, m_chunksY, rotation) };
+                t_func(chunkPosition.y * m_chunksX + chunkPosition.x);
             }
+        }
 
-            return neighborFlag;
+        /**
+         * @brief Calls a function for each visible and renderable tile in render order.
+         *
+         * @param t_func The function to call with a reference to the tile.
+         */
+        template <typename F>
+        void ForEachCurrentTile(F&& t_func)
+        {
+            const auto rotation{ world->camera->rotation };
+
+            for (const auto& [chunkIndex, begin, end] : currentSpans)
+            {
+                const auto& chunk{ chunks[chunkIndex] };
+
+                for (auto k{ begin }; k < end; ++k)
+                {
+                    const auto position{ get_map_position(k, chunk.width, chunk.height, rotation) };
+                    if (auto& tile{ tiles[chunk.begin + position.y * chunk.width + position.x] }; !tile.IsNotRenderable())
+                    {
+                        t_func(tile);
+                    }
+                }
+            }
         }
 
         //-------------------------------------------------
-        // Current tiles to render
+        // Serializing
         //-------------------------------------------------
 
         /**
-         * @brief Set `currentTiles` with the visible tiles to render.
-         *
-         * @param t_xOffset The x offset to check if the position is off screen.
-         * @param t_yOffset The y offset to check if the position is off screen.
+         * @brief Writes all tiles row by row into a Json array.
          *
-         * @return True if visible tiles were found; false otherwise.
+         * @return The Json array.
          */
-        bool UpdateCurrentTiles(const int t_xOffset, const int t_yOffset)
+        [[nodiscard]] nlohmann::json TilesToJson() const
         {
-            std::vector<T>().swap(currentTiles);
-            currentTiles = sortedTiles.at(magic_enum::enum_integer(world->camera->rotation));
-
-            auto [begin, end]{ std::ranges::remove_if(currentTiles, [&](const T& t_tile) {
-                return world->IsWorldPositionOutsideScreen(t_tile.posX + t_xOffset, t_tile.posY + t_yOffset) || t_tile.IsNotRenderable();
-            } )};
-
-            currentTiles.erase(begin, end);
+            auto json{ nlohmann::json::array() };
 
-            MDCII_LOG_DEBUG("[Layer::UpdateCurrentTiles()] Render {} current tiles for layer {}.",
-                currentTiles.size(),
-                magic_enum::enum_name(layerType)
-            );
+            for (auto y{ 0 }; y < height; ++y)
+            {
+                for (auto x{ 0 }; x < width; ++x)
+                {
+                    json.push_back(GetTile(x, y));
+                }
+            }
 
-            return !currentTiles.empty();
+            return json;
         }
 
         //-------------------------------------------------
@@ -412,14 +513,9 @@ namespace mdcii::world::layer
          */
         void AddTile(T& t_tile)
         {
-            t_tile.CalcRenderPositions(width, height);
-
-            PreTileAdd(t_tile);
-
-            ReplaceTileInTilesArray(t_tile);
-            IntoSortedTilesArray(t_tile);
+            InsertTile(t_tile);
 
-            PostTileAdd(t_tile);
+            PostTilesAdd();
         }
 
         /**
@@ -435,8 +531,50 @@ namespace mdcii::world::layer
 
             for (auto& tile : t_tiles)
             {
-                AddTile(tile);
+                InsertTile(tile);
             }
+
+            PostTilesAdd();
+        }
+
+        //-------------------------------------------------
+        // Animations
+        //-------------------------------------------------
+
+        /**
+         * @brief Sets the current frame of all animated tiles.
+         */
+        void UpdateAnimations()
+        {
+            for (const auto& [tileIndex, clock, animAnz] : m_animatedTiles)
+            {
+                tiles[tileIndex].frame = static_cast<uint8_t>(resource::AnimationClock::GetFrame(clock, animAnz));
+            }
+        }
+
+        /**
+         * @brief Checks whether a chunk with changed tiles is on the screen.
+         *
+         * @param t_spans The ranges of the chunks that are on the screen.
+         *
+         * @return True if a visible chunk has changed; otherwise false.
+         */
+        [[nodiscard]] bool HasVisibleDirtyChunks(const std::vector<TileSpan>& t_spans) const
+        {
+            return !dirtyChunks.empty() && std::ranges::any_of(t_spans, [this](const TileSpan& t_span) { return chunks[t_span.chunk].dirty; });
+        }
+
+        /**
+         * @brief Resets the dirty state of all chunks after the changes have been processed.
+         */
+        void ClearDirtyChunks()
+        {
+            for (const auto chunkIndex : dirtyChunks)
+            {
+                chunks[chunkIndex].dirty = false;
+            }
+
+            dirtyChunks.clear();
         }
 
     protected:
@@ -444,6 +582,20 @@ namespace mdcii::world::layer
         // Helper
         //-------------------------------------------------
 
+        /**
+         * @brief Inserts a tile into the layer without the final `PostTilesAdd()` step.
+         *
+         * @param t_tile The tile to be inserted.
+         */
+        void InsertTile(T& t_tile)
+        {
+            PreTileAdd(t_tile);
+
+            ReplaceTileInTilesArray(t_tile);
+
+            PostTileAdd(t_tile);
+        }
+
         /**
          * @brief Replaces a tile in the `tiles` array with the content of a given tile.
          *
@@ -451,30 +603,178 @@ namespace mdcii::world::layer
          */
         void ReplaceTileInTilesArray(T& t_tile)
         {
-            tiles.at(t_tile.renderIndices[0]) = t_tile;
+            tiles.at(GetTileIndex(t_tile.posX, t_tile.posY)) = t_tile;
+            MarkDirty(t_tile.posX, t_tile.posY);
+        }
+
+        /**
+         * @brief Adds a tile to the animated tiles if the animation has more than one frame.
+         *
+         * @param t_tileIndex The index of the tile in `tiles`.
+         * @param t_animTime The animation time in milliseconds.
+         * @param t_animAnz The number of frames of the animation.
+         */
+        void TrackAnimation(const int t_tileIndex, const int t_animTime, const int t_animAnz)
+        {
+            if (t_animAnz <= 1)
+            {
+                return;
+            }
+
+            if (const auto clock{ resource::AnimationClock::GetClock(t_animTime) }; clock != resource::AnimationClock::NO_CLOCK)
+            {
+                if (m_animatedSlots.empty())
+                {
+                    m_animatedSlots.assign(tiles.size(), NO_SLOT);
+                }
+
+                const AnimatedTile animatedTile{ t_tileIndex, static_cast<int16_t>(clock), static_cast<int16_t>(t_animAnz) };
+                if (auto& slot{ m_animatedSlots[t_tileIndex] }; slot != NO_SLOT)
+                {
+                    m_animatedTiles[slot] = animatedTile;
+                }
+                else
+                {
+                    slot = static_cast<int32_t>(m_animatedTiles.size());
+                    m_animatedTiles.push_back(animatedTile);
+                }
+            }
         }
 
         /**
-         * @brief Copies a tile from `tiles`array into the `sortedTiles` array.
+         * @brief Removes a tile from the animated tiles.
+         *
+         * The last animated tile is moved into the slot of the removed tile.
          *
-         * @param t_tile The tile to copy.
+         * @param t_tileIndex The index of the tile in `tiles`.
          */
-        void IntoSortedTilesArray(T& t_tile)
+        void UntrackAnimation(const int t_tileIndex)
         {
-            using enum Rotation;
+            tiles[t_tileIndex].frame = 0;
 
-            auto idx0{ sortedIndices.at(magic_enum::enum_integer(DEG0)).at(t_tile.renderIndices[0]) };
-            auto idx90{ sortedIndices.at(magic_enum::enum_integer(DEG90)).at(t_tile.renderIndices[1]) };
-            auto idx180{ sortedIndices.at(magic_enum::enum_integer(DEG180)).at(t_tile.renderIndices[2]) };
-            auto idx270{ sortedIndices.at(magic_enum::enum_integer(DEG270)).at(t_tile.renderIndices[3]) };
+            if (m_animatedSlots.empty() || m_animatedSlots[t_tileIndex] == NO_SLOT)
+            {
+                return;
+            }
 
-            sortedTiles.at(magic_enum::enum_integer(DEG0)).at(idx0) = t_tile;
-            sortedTiles.at(magic_enum::enum_integer(DEG90)).at(idx90) = t_tile;
-            sortedTiles.at(magic_enum::enum_integer(DEG180)).at(idx180) = t_tile;
-            sortedTiles.at(magic_enum::enum_integer(DEG270)).at(idx270) = t_tile;
+            const auto slot{ m_animatedSlots[t_tileIndex] };
+            m_animatedTiles[slot] = m_animatedTiles.back();
+            m_animatedSlots[m_animatedTiles[slot].tileIndex] = slot;
+            m_animatedTiles.pop_back();
+            m_animatedSlots[t_tileIndex] = NO_SLOT;
+        }
+
+        /**
+         * @brief Records that the tile at a position has changed.
+         *
+         * @param t_x The x position on the layer.
+         * @param t_y The y position on the layer.
+         */
+        void MarkDirty(const int t_x, const int t_y)
+        {
+            const auto chunkIndex{ GetChunkIndex(t_x, t_y) };
+            if (auto& chunk{ chunks[chunkIndex] }; !chunk.dirty)
+            {
+                chunk.dirty = true;
+                dirtyChunks.push_back(chunkIndex);
+            }
         }
 
     private:
+        //-------------------------------------------------
+        // Constants
+        //-------------------------------------------------
+
+        /**
+         * @brief Marks a tile without an entry in `m_animatedTiles`.
+         */
+        static constexpr int32_t NO_SLOT{ -1 };
+
+        //-------------------------------------------------
+        // Member
+        //-------------------------------------------------
+
+        /**
+         * @brief The number of chunks in x direction.
+         */
+        int m_chunksX{ 0 };
+
+        /**
+         * @brief The number of chunks in y direction.
+         */
+        int m_chunksY{ 0 };
+
+        /**
+         * @brief The world position of the layer for which the chunk bounds were calculated.
+         */
+        std::optional<olc::vi2d> m_chunkBoundsOffset;
+
+        /**
+         * @brief The tiles with an animation; all other tiles keep frame 0.
+         */
+        std::vector<AnimatedTile> m_animatedTiles;
+
+        /**
+         * @brief The index into `m_animatedTiles` of each tile or `NO_SLOT`.
+         */
+        std::vector<int32_t> m_animatedSlots;
+
+        //-------------------------------------------------
+        // Chunks
+        //-------------------------------------------------
+
+        /**
+         * @brief Splits the layer into chunks.
+         */
+        void InitChunks()
+        {
+            m_chunksX = (width + LayerChunk::SIZE - 1) / LayerChunk::SIZE;
+            m_chunksY = (height + LayerChunk::SIZE - 1) / LayerChunk::SIZE;
+
+            chunks.reserve(m_chunksX * static_cast<size_t>(m_chunksY));
+
+            for (auto cy{ 0 }; cy < m_chunksY; ++cy)
+            {
+                for (auto cx{ 0 }; cx < m_chunksX; ++cx)
+                {
+                    LayerChunk chunk;
+                    chunk.x = cx * LayerChunk::SIZE;
+                    chunk.y = cy * LayerChunk::SIZE;
+                    chunk.width = std::min(LayerChunk::SIZE, width - chunk.x);
+                    chunk.height = std::min(LayerChunk::SIZE, height - chunk.y);
+
+                    // all chunks above are full rows; all chunks on the left have the same height
+                    chunk.begin = chunk.y * width + chunk.x * chunk.height;
+
+                    chunks.push_back(chunk);
+                }
+            }
+        }
+
+        /**
+         * @brief Calculates the screen bounds of each chunk for all zooms and rotations.
+         *
+         * @param t_offset The world position of the layer.
+         */
+        void CalcChunkBounds(const olc::vi2d& t_offset)
+        {
+            for (auto& chunk : chunks)
+            {
+                for (const auto zoom : magic_enum::enum_values<Zoom>())
+                {
+                    for (const auto rotation : magic_enum::enum_values<Rotation>())
+                    {
+                        chunk.screenAabbs[magic_enum::enum_integer(zoom)][magic_enum::enum_integer(rotation)] = world->viewport->CalcScreenAabb(
+                            t_offset.x + chunk.x, t_offset.y + chunk.y,
+                            chunk.width, chunk.height,
+                            zoom, rotation
+                        );
+                    }
+                }
+            }
+
+            m_chunkBoundsOffset = t_offset;
+        }
 
     };
 
@@ -505,6 +805,7 @@ namespace mdcii::world::layer
          */
         TerrainLayer(const World* t_world, LayerType t_layerType, const int t_width, const int t_height)
             : Layer(t_world, t_layerType, t_width, t_height)
+            , m_trafficMasks(t_width * static_cast<size_t>(t_height), 0)
         {
             MDCII_LOG_DEBUG("[TerrainLayer::TerrainLayer()] Create TerrainLayer of type {}.", magic_enum::enum_name(layerType));
         }
@@ -549,14 +850,15 @@ namespace mdcii::world::layer
 
             if (t_json.count("rotation"))
             {
-                tile.rotation = t_json.at("rotation");
+                const int rotation{ t_json.at("rotation") };
                 if (tile.HasBuilding() && tile.building->IsRotatable())
                 {
-                    if (tile.rotation < 0 || tile.rotation > 3)
+                    if (rotation < 0 || rotation > 3)
                     {
                         throw MDCII_EXCEPTION("[TerrainLayer::CreateTileFromJson()] Invalid building rotation.");
                     }
                 }
+                tile.rotation = static_cast<uint8_t>(rotation);
             }
 
             if (t_json.count("x"))
@@ -580,16 +882,20 @@ namespace mdcii::world::layer
          */
         void InitTile(const int t_x, const int t_y) override
         {
-            auto& tile{ tiles.at(t_y * width + t_x) };
+            auto& tile{ GetTile(t_x, t_y) };
             tile.posX = t_x;
             tile.posY = t_y;
 
             if (tile.HasBuilding())
             {
                 tile.CalculateGfxValues();
+                TrackAnimation(GetTileIndex(t_x, t_y), tile.building->animTime, tile.building->animAnz);
             }
 
-            tile.CalcRenderPositions(width, height);
+            if (tile.type == tile::Tile::TileType::TRAFFIC)
+            {
+                SetTrafficCell(t_x, t_y, true);
+            }
         }
 
         /**
@@ -599,15 +905,11 @@ namespace mdcii::world::layer
          */
         void PreTileAdd(tile::TerrainTile& t_tileToAdd) override
         {
-            if (t_tileToAdd.type == tile::Tile::TileType::TRAFFIC)
-            {
-                t_tileToAdd.n = tiles.at(t_tileToAdd.renderIndices[magic_enum::enum_integer(world->camera->rotation)]).n;
-                t_tileToAdd.s = tiles.at(t_tileToAdd.renderIndices[magic_enum::enum_integer(world->camera->rotation)]).s;
-                t_tileToAdd.e = tiles.at(t_tileToAdd.renderIndices[magic_enum::enum_integer(world->camera->rotation)]).e;
-                t_tileToAdd.w = tiles.at(t_tileToAdd.renderIndices[magic_enum::enum_integer(world->camera->rotation)]).w;
-
-                t_tileToAdd.DetermineTrafficGfx(CalcNeighborFlag(t_tileToAdd));
-            }
+            const auto& oldTile{ GetTile(t_tileToAdd.posX, t_tileToAdd.posY) };
+            t_tileToAdd.n = oldTile.n;
+            t_tileToAdd.s = oldTile.s;
+            t_tileToAdd.e = oldTile.e;
+            t_tileToAdd.w = oldTile.w;
         }
 
         /**
@@ -617,65 +919,167 @@ namespace mdcii::world::layer
          */
         void PostTileAdd(tile::TerrainTile& t_tile) override
         {
-            if (t_tile.type == tile::Tile::TileType::TRAFFIC)
+            const auto tileIndex{ GetTileIndex(t_tile.posX, t_tile.posY) };
+            UntrackAnimation(tileIndex);
+            if (t_tile.HasBuilding())
+            {
+                TrackAnimation(tileIndex, t_tile.building->animTime, t_tile.building->animAnz);
+            }
+
+            SetTrafficCell(t_tile.posX, t_tile.posY, t_tile.type == tile::Tile::TileType::TRAFFIC);
+        }
+
+        /**
+         * Determines the gfx of all traffic tiles affected by the added tiles in one pass.
+         */
+        void PostTilesAdd() override
+        {
+            if (m_pendingTrafficCells.empty())
             {
-                HandleTrafficNeighbors(t_tile);
+                return;
             }
+
+            std::ranges::sort(m_pendingTrafficCells);
+            const auto [first, last]{ std::ranges::unique(m_pendingTrafficCells) };
+            m_pendingTrafficCells.erase(first, last);
+
+            MDCII_LOG_DEBUG("[TerrainLayer::PostTilesAdd()] Update the gfx of {} traffic tiles.", m_pendingTrafficCells.size());
+
+            for (const auto cell : m_pendingTrafficCells)
+            {
+                const auto mask{ m_trafficMasks[cell] };
+                if ((mask & TRAFFIC_BIT) == 0)
+                {
+                    continue;
+                }
+
+                const auto x{ cell % width };
+                const auto y{ cell / width };
+                if (GetTile(x, y).DetermineTrafficGfx(mask & NEIGHBOR_BITS))
+                {
+                    MarkDirty(x, y);
+                }
+            }
+
+            m_pendingTrafficCells.clear();
+        }
+
+        //-------------------------------------------------
+        // Traffic
+        //-------------------------------------------------
+
+        /**
+         * @brief Determines the traffic neighbors of a position.
+         *
+         * @param t_x The x position on the layer.
+         * @param t_y The y position on the layer.
+         *
+         * @return A 4-bit flag with the tile::Tile::NeighborFlag values of the traffic neighbors.
+         */
+        [[nodiscard]] uint8_t GetTrafficNeighborFlag(const int t_x, const int t_y) const
+        {
+            MDCII_ASSERT(t_x >= 0 && t_x < width && t_y >= 0 && t_y < height, "[TerrainLayer::GetTrafficNeighborFlag()] Invalid position given.")
+
+            return m_trafficMasks[t_y * width + t_x] & NEIGHBOR_BITS;
         }
 
     protected:
 
     private:
+        //-------------------------------------------------
+        // Constants
+        //-------------------------------------------------
+
+        /**
+         * @brief The bits of the tile::Tile::NeighborFlag values in a traffic mask.
+         */
+        static constexpr uint8_t NEIGHBOR_BITS{ tile::Tile::NORTH | tile::Tile::EAST | tile::Tile::SOUTH | tile::Tile::WEST };
+
+        /**
+         * @brief The bit set in a traffic mask if the position itself is a traffic tile.
+         */
+        static constexpr uint8_t TRAFFIC_BIT{ 16 };
+
+        //-------------------------------------------------
+        // Member
+        //-------------------------------------------------
+
+        /**
+         * @brief A mask for each position, row by row.
+         *
+         * Contains the `TRAFFIC_BIT` and the tile::Tile::NeighborFlag values of the traffic neighbors.
+         */
+        std::vector<uint8_t> m_trafficMasks;
+
+        /**
+         * @brief The row-major indices of the traffic tiles whose gfx must be determined again.
+         */
+        std::vector<int> m_pendingTrafficCells;
+
         //-------------------------------------------------
         // Helper
         //-------------------------------------------------
 
         /**
-         * Fixes the Gfx of all neighbors of a traffic tile.
+         * @brief Sets or clears the traffic state of a position and updates the masks of the neighbors.
          *
-         * @param t_tile The tile from which the neighbors are to be corrected.
+         * The position and all of its traffic neighbors are recorded in `m_pendingTrafficCells`.
+         *
+         * @param t_x The x position on the layer.
+         * @param t_y The y position on the layer.
+         * @param t_traffic True if the position is a traffic tile.
          */
-        void HandleTrafficNeighbors(const tile::TerrainTile& t_tile)
+        void SetTrafficCell(const int t_x, const int t_y, const bool t_traffic)
         {
-            if (t_tile.n >= 0 && sortedTiles.at(magic_enum::enum_integer(world->camera->rotation)).at(t_tile.n).type == tile::Tile::TileType::TRAFFIC)
+            const auto cell{ t_y * width + t_x };
+            if (((m_trafficMasks[cell] & TRAFFIC_BIT) != 0) == t_traffic)
             {
-                auto& nt{ sortedTiles.at(magic_enum::enum_integer(world->camera->rotation)).at(t_tile.n) };
-                if (nt.DetermineTrafficGfx(CalcNeighborFlag(nt)))
-                {
-                    ReplaceTileInTilesArray(nt);
-                    IntoSortedTilesArray(nt);
-                }
+                return;
             }
 
-            if (t_tile.e >= 0 && sortedTiles.at(magic_enum::enum_integer(world->camera->rotation)).at(t_tile.e).type == tile::Tile::TileType::TRAFFIC)
+            const auto updateNeighbor{ [&](const int t_neighbor, const uint8_t t_flag, const uint8_t t_oppositeFlag)
             {
-                auto& nt{ sortedTiles.at(magic_enum::enum_integer(world->camera->rotation)).at(t_tile.e) };
-                if (nt.DetermineTrafficGfx(CalcNeighborFlag(nt)))
+                if (t_traffic)
                 {
-                    ReplaceTileInTilesArray(nt);
-                    IntoSortedTilesArray(nt);
+                    m_trafficMasks[t_neighbor] |= t_oppositeFlag;
+                }
+                else
+                {
+                    m_trafficMasks[t_neighbor] &= static_cast<uint8_t>(~t_oppositeFlag);
                 }
-            }
 
-            if (t_tile.s >= 0 && sortedTiles.at(magic_enum::enum_integer(world->camera->rotation)).at(t_tile.s).type == tile::Tile::TileType::TRAFFIC)
-            {
-                auto& nt{ sortedTiles.at(magic_enum::enum_integer(world->camera->rotation)).at(t_tile.s) };
-                if (nt.DetermineTrafficGfx(CalcNeighborFlag(nt)))
+                if ((m_trafficMasks[t_neighbor] & TRAFFIC_BIT) != 0)
                 {
-                    ReplaceTileInTilesArray(nt);
-                    IntoSortedTilesArray(nt);
+                    m_trafficMasks[cell] |= t_flag;
+                    m_pendingTrafficCells.push_back(t_neighbor);
                 }
+            } };
+
+            m_trafficMasks[cell] = t_traffic ? TRAFFIC_BIT : 0;
+
+            using enum tile::Tile::NeighborFlag;
+
+            if (t_y > 0)
+            {
+                updateNeighbor(cell - width, NORTH, SOUTH);
             }
 
-            if (t_tile.w >= 0 && sortedTiles.at(magic_enum::enum_integer(world->camera->rotation)).at(t_tile.w).type == tile::Tile::TileType::TRAFFIC)
+            if (t_x < width - 1)
             {
-                auto& nt{ sortedTiles.at(magic_enum::enum_integer(world->camera->rotation)).at(t_tile.w) };
-                if (nt.DetermineTrafficGfx(CalcNeighborFlag(nt)))
-                {
-                    ReplaceTileInTilesArray(nt);
-                    IntoSortedTilesArray(nt);
-                }
+                updateNeighbor(cell + 1, EAST, WEST);
             }
+
+            if (t_y < height - 1)
+            {
+                updateNeighbor(cell + width, SOUTH, NORTH);
+            }
+
+            if (t_x > 0)
+            {
+                updateNeighbor(cell - 1, WEST, EAST);
+            }
+
+            m_pendingTrafficCells.push_back(cell);
         }
     };
 
@@ -750,14 +1154,15 @@ namespace mdcii::world::layer
 
             if (t_json.count("rotation"))
             {
-                tile.rotation = t_json.at("rotation");
+                const int rotation{ t_json.at("rotation") };
                 if (tile.HasFigure() && tile.figure->IsRotatable())
                 {
-                    if (tile.rotation < 0 || tile.rotation >= tile.figure->rotate)
+                    if (rotation < 0 || rotation >= tile.figure->rotate)
                     {
                         throw MDCII_EXCEPTION("[FiguresLayer::CreateTileFromJson()] Invalid figure rotation.");
                     }
                 }
+                tile.rotation = static_cast<uint8_t>(rotation);
             }
 
             if (t_json.count("animation"))
@@ -783,11 +1188,15 @@ namespace mdcii::world::layer
          */
         void InitTile(const int t_x, const int t_y) override
         {
-            auto& tile{ tiles.at(t_y * width + t_x) };
+            auto& tile{ GetTile(t_x, t_y) };
             tile.posX = t_x;
             tile.posY = t_y;
 
-            tile.CalcRenderPositions(width, height);
+            if (tile.HasFigure())
+            {
+                ++m_figureCounts[magic_enum::enum_integer(tile.figure->id)];
+                TrackFigureAnimation(t_x, t_y);
+            }
         }
 
         //-------------------------------------------------
@@ -799,18 +1208,92 @@ namespace mdcii::world::layer
          *
          * @return The number of figure tiles.
          */
-        [[nodiscard]] int CountFigures(const resource::FigureId t_figureId)
+        [[nodiscard]] int CountFigures(const resource::FigureId t_figureId) const
+        {
+            return m_figureCounts[magic_enum::enum_integer(t_figureId)];
+        }
+
+        //-------------------------------------------------
+        // Add && remove figures
+        //-------------------------------------------------
+
+        /**
+         * @brief Places a figure on a tile without a figure.
+         *
+         * @param t_x The x position of the tile.
+         * @param t_y The y position of the tile.
+         * @param t_figure Pointer to the Figure object.
+         * @param t_rotation The rotation of the figure.
+         * @param t_animation The index of the animation to use.
+         */
+        void AddFigure(const int t_x, const int t_y, const resource::Figure* t_figure, const int t_rotation, const int t_animation)
+        {
+            MDCII_ASSERT(t_figure, "[FiguresLayer::AddFigure()] Null pointer.")
+
+            auto& tile{ GetTile(t_x, t_y) };
+
+            MDCII_ASSERT(!tile.HasFigure(), "[FiguresLayer::AddFigure()] The tile already has a figure.")
+
+            tile.figure = t_figure;
+            tile.rotation = static_cast<uint8_t>(t_rotation);
+            tile.currentAnimation = t_animation;
+            TrackFigureAnimation(t_x, t_y);
+
+            ++m_figureCounts[magic_enum::enum_integer(t_figure->id)];
+            MarkDirty(t_x, t_y);
+        }
+
+        /**
+         * @brief Removes the figure of a tile.
+         *
+         * @param t_x The x position of the tile.
+         * @param t_y The y position of the tile.
+         */
+        void RemoveFigure(const int t_x, const int t_y)
         {
-            const auto count{ std::ranges::count_if(tiles, [t_figureId](const tile::FigureTile& t_tile) {
-                return t_tile.HasFigure(t_figureId);
-            }) };
+            auto& tile{ GetTile(t_x, t_y) };
+            if (!tile.HasFigure())
+            {
+                return;
+            }
+
+            --m_figureCounts[magic_enum::enum_integer(tile.figure->id)];
+            UntrackAnimation(GetTileIndex(t_x, t_y));
+
+            tile.figure = nullptr;
+            tile.rotation = 0;
+            tile.currentAnimation = 0;
 
-            return static_cast<int>(count);
+            MarkDirty(t_x, t_y);
         }
 
     protected:
 
     private:
+        //-------------------------------------------------
+        // Member
+        //-------------------------------------------------
+
+        /**
+         * @brief The number of figures for each FigureId.
+         */
+        std::array<int, magic_enum::enum_count<resource::FigureId>()> m_figureCounts{};
 
+        //-------------------------------------------------
+        // Helper
+        //-------------------------------------------------
+
+        /**
+         * @brief Adds the figure tile to the animated tiles if its current animation has more than one frame.
+         *
+         * @param t_x The x position of the tile.
+         * @param t_y The y position of the tile.
+         */
+        void TrackFigureAnimation(const int t_x, const int t_y)
+        {
+            const auto& tile{ GetTile(t_x, t_y) };
+            const auto& animation{ tile.figure->animations.at(tile.currentAnimation) };
+            TrackAnimation(GetTileIndex(t_x, t_y), animation.animSpeed, animation.animAnz);
+        }
     };
 }
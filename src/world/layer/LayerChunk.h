@@ -0,0 +1,88 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include "world/Rotation.h"
+#include "world/Zoom.h"
+#include "physics/Aabb.h"
+
+namespace mdcii::world::layer
+{
+    //-------------------------------------------------
+    // LayerChunk
+    //-------------------------------------------------
+
+    /**
+     * @brief A rectangular part of a layer whose tiles are stored one after the other.
+     *
+     * The tiles of a chunk are stored row by row starting at `begin`.
+     */
+    struct LayerChunk
+    {
+        //-------------------------------------------------
+        // Constants
+        //-------------------------------------------------
+
+        /**
+         * @brief The maximum width and height of a chunk in tiles.
+         */
+        static constexpr auto SIZE{ 16 };
+
+        //-------------------------------------------------
+        // Member
+        //-------------------------------------------------
+
+        /**
+         * @brief The x position of the first tile on the layer.
+         */
+        int x{ 0 };
+
+        /**
+         * @brief The y position of the first tile on the layer.
+         */
+        int y{ 0 };
+
+        /**
+         * @brief The width of the chunk in tiles.
+         */
+        int width{ 0 };
+
+        /**
+         * @brief The height of the chunk in tiles.
+         */
+        int height{ 0 };
+
+        /**
+         * @brief The index of the first tile of the chunk in the tiles of the layer.
+         */
+        int32_t begin{ 0 };
+
+        /**
+         * @brief Set if a tile of the chunk has been replaced.
+         */
+        bool dirty{ false };
+
+        /**
+         * @brief The bounds of the tile screen positions for each zoom and rotation, without the camera offset.
+         */
+        std::array<std::array<physics::Aabb, magic_enum::enum_count<Rotation>()>, NR_OF_ZOOMS> screenAabbs;
+    };
+}
@@ -0,0 +1,97 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#include "MixedLayer.h"
+
+//-------------------------------------------------
+// Ctors. / Dtor.
+//-------------------------------------------------
+
+mdcii::world::layer::MixedLayer::MixedLayer(
+    TerrainLayer<tile::TerrainTile>* t_coastLayer,
+    TerrainLayer<tile::TerrainTile>* t_terrainLayer,
+    TerrainLayer<tile::TerrainTile>* t_buildingsLayer
+)
+    : m_layers{ t_coastLayer, t_terrainLayer, t_buildingsLayer }
+    , m_buildingsLayer{ t_buildingsLayer }
+{
+    MDCII_LOG_DEBUG("[MixedLayer::MixedLayer()] Create MixedLayer.");
+
+    MDCII_ASSERT(t_coastLayer && t_terrainLayer && t_buildingsLayer, "[MixedLayer::MixedLayer()] Null pointer.")
+    MDCII_ASSERT(t_coastLayer->tiles.size() == t_buildingsLayer->tiles.size() && t_terrainLayer->tiles.size() == t_buildingsLayer->tiles.size(),
+        "[MixedLayer::MixedLayer()] Invalid layer size.")
+
+    m_sources.resize(m_buildingsLayer->tiles.size());
+    for (auto i{ 0 }; i < static_cast<int>(m_sources.size()); ++i)
+    {
+        m_sources[i] = FindSource(i);
+    }
+}
+
+mdcii::world::layer::MixedLayer::~MixedLayer() noexcept
+{
+    MDCII_LOG_DEBUG("[MixedLayer::~MixedLayer()] Destruct MixedLayer.");
+}
+
+//-------------------------------------------------
+// Sources
+//-------------------------------------------------
+
+void mdcii::world::layer::MixedLayer::UpdateSource(const int t_x, const int t_y)
+{
+    const auto index{ m_buildingsLayer->GetTileIndex(t_x, t_y) };
+    m_sources[index] = FindSource(index);
+}
+
+const mdcii::world::tile::TerrainTile& mdcii::world::layer::MixedLayer::GetTile(const int t_x, const int t_y) const
+{
+    const auto index{ m_buildingsLayer->GetTileIndex(t_x, t_y) };
+    return m_layers[m_sources[index]]->tiles[index];
+}
+
+//-------------------------------------------------
+// Current tiles to render
+//-------------------------------------------------
+
+bool mdcii::world::layer::MixedLayer::UpdateCurrentTiles(const int t_xOffset, const int t_yOffset)
+{
+    // all layers have the same chunks
+    m_buildingsLayer->CalcCurrentSpans(t_xOffset, t_yOffset, currentSpans);
+
+    MDCII_LOG_DEBUG("[MixedLayer::UpdateCurrentTiles()] Found {} visible ranges.", currentSpans.size());
+
+    return !currentSpans.empty();
+}
+
+//-------------------------------------------------
+// Helper
+//-------------------------------------------------
+
+uint8_t mdcii::world::layer::MixedLayer::FindSource(const int t_index) const
+{
+    // the top-most layer with a building, or the empty tile of the BUILDINGS layer
+    for (auto source{ static_cast<int>(m_layers.size()) - 1 }; source >= 0; --source)
+    {
+        if (m_layers[source]->tiles[t_index].HasBuilding())
+        {
+            return static_cast<uint8_t>(source);
+        }
+    }
+
+    return static_cast<uint8_t>(m_layers.size() - 1);
+}
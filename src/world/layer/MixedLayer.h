@@ -0,0 +1,202 @@
+// This file is part of the MDCII project.
+//
+// Copyright (c) 2024. stwe <https://github.com/stwe/MDCII>
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#pragma once
+
+#include <array>
+#include "world/layer/Layer.h"
+
+namespace mdcii::world::layer
+{
+    //-------------------------------------------------
+    // MixedLayer
+    //-------------------------------------------------
+
+    /**
+     * @brief A view that combines the COAST, TERRAIN and BUILDINGS layers of an island.
+     *
+     * No tiles are copied. For each position only the source layer of the top-most
+     * tile is stored. A tile of the BUILDINGS layer has priority over a tile of the
+     * TERRAIN layer, which has priority over a tile of the COAST layer.
+     */
+    class MixedLayer
+    {
+    public:
+        //-------------------------------------------------
+        // Member
+        //-------------------------------------------------
+
+        /**
+         * @brief The ranges of the chunks in render order that are on the screen.
+         */
+        std::vector<TileSpan> currentSpans;
+
+        //-------------------------------------------------
+        // Ctors. / Dtor.
+        //-------------------------------------------------
+
+        MixedLayer() = delete;
+
+        /**
+         * @brief Constructs a new MixedLayer object.
+         *
+         * All layers must have the same size.
+         *
+         * @param t_coastLayer Pointer to the COAST layer.
+         * @param t_terrainLayer Pointer to the TERRAIN layer.
+         * @param t_buildingsLayer Pointer to the BUILDINGS layer.
+         */
+        MixedLayer(
+            TerrainLayer<tile::TerrainTile>* t_coastLayer,
+            TerrainLayer<tile::TerrainTile>* t_terrainLayer,
+            TerrainLayer<tile::TerrainTile>* t_buildingsLayer
+        );
+
+        MixedLayer(const MixedLayer& t_other) = delete;
+        MixedLayer(MixedLayer&& t_other) noexcept = delete;
+        MixedLayer& operator=(const MixedLayer& t_other) = delete;
+        MixedLayer& operator=(MixedLayer&& t_other) noexcept = delete;
+
+        ~MixedLayer() noexcept;
+
+        //-------------------------------------------------
+        // Sources
+        //-------------------------------------------------
+
+        /**
+         * @brief Determines the source layer of a position again after a tile has been added.
+         *
+         * @param t_x The x position on the layer.
+         * @param t_y The y position on the layer.
+         */
+        void UpdateSource(int t_x, int t_y);
+
+        /**
+         * @brief Returns the top-most tile of a position.
+         *
+         * @param t_x The x position on the layer.
+         * @param t_y The y position on the layer.
+         *
+         * @return A reference to the tile of the source layer.
+         */
+        [[nodiscard]] const tile::TerrainTile& GetTile(int t_x, int t_y) const;
+
+        //-------------------------------------------------
+        // Current tiles to render
+        //-------------------------------------------------
+
+        /**
+         * @brief Set `currentSpans` with the ranges of the visible tiles.
+         *
+         * @param t_xOffset The world x position of the layer.
+         * @param t_yOffset The world y position of the layer.
+         *
+         * @return True if visible tiles were found; false otherwise.
+         */
+        bool UpdateCurrentTiles(int t_xOffset, int t_yOffset);
+
+        /**
+         * @brief Calls a function for each visible and renderable tile in render order.
+         *
+         * @param t_func The function to call with a reference to the tile.
+         */
+        template <typename F>
+        void ForEachCurrentTile(F&& t_func)
+        {
+            const auto rotation{ m_buildingsLayer->world->camera->rotation };
+
+            for (const auto& [chunkIndex, begin, end] : currentSpans)
+            {
+                const auto& chunk{ m_buildingsLayer->chunks[chunkIndex] };
+
+                for (auto k{ begin }; k < end; ++k)
+                {
+                    const auto position{ get_map_position(k, chunk.width, chunk.height, rotation) };
+                    const auto index{ chunk.begin + position.y * chunk.width + position.x };
+
+                    if (auto& tile{ m_layers[m_sources[index]]->tiles[index] }; !tile.IsNotRenderable())
+                    {
+                        t_func(tile);
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Calls a function for each renderable tile in the same order as `ForEachCurrentTile()`, visible or not.
+         *
+         * @param t_func The function to call with a reference to the tile.
+         */
+        template <typename F>
+        void ForEachTile(F&& t_func) const
+        {
+            const auto rotation{ m_buildingsLayer->world->camera->rotation };
+
+            m_buildingsLayer->ForEachChunkIndex([&](const int t_chunkIndex)
+            {
+                const auto& chunk{ m_buildingsLayer->chunks[t_chunkIndex] };
+
+                for (auto k{ 0 }; k < chunk.width * chunk.height; ++k)
+                {
+                    const auto position{ get_map_position(k, chunk.width, chunk.height, rotation) };
+                    const auto index{ chunk.begin + position.y * chunk.width + position.x };
+
+                    if (const auto& tile{ m_layers[m_sources[index]]->tiles[index] }; !tile.IsNotRenderable())
+                    {
+                        t_func(tile);
+                    }
+                }
+            });
+        }
+
+    protected:
+
+    private:
+        //-------------------------------------------------
+        // Member
+        //-------------------------------------------------
+
+        /**
+         * @brief The source layers in ascending priority.
+         */
+        std::array<TerrainLayer<tile::TerrainTile>*, 3> m_layers;
+
+        /**
+         * @brief Pointer to the BUILDINGS layer, which also provides the chunks.
+         */
+        TerrainLayer<tile::TerrainTile>* m_buildingsLayer{ nullptr };
+
+        /**
+         * @brief The index into `m_layers` for each tile index.
+         */
+        std::vector<uint8_t> m_sources;
+
+        //-------------------------------------------------
+        // Helper
+        //-------------------------------------------------
+
+        /**
+         * @brief Determines the source layer of a tile index.
+         *
+         * @param t_index The tile index, which is the same on all layers.
+         *
+         * @return The index into `m_layers`.
+         */
+        [[nodiscard]] uint8_t FindSource(int t_index) const;
+    };
+}
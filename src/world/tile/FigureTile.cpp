@@ -47,46 +47,9 @@ bool mdcii::world::tile::FigureTile::HasFigure(const resource::FigureId t_figure
 }
 
 //-------------------------------------------------
-// Logic
+// Serializing
 //-------------------------------------------------
 
-void mdcii::world::tile::FigureTile::UpdateFrame(const std::array<int, NR_OF_ANIM_TIMES>& t_frameValues)
-{
-    // 75, 110, 130, 135, 195, 300, 500, 750, 1000
-    switch (figure->animations[currentAnimation].animSpeed)
-    {
-        case 75:
-            frame = t_frameValues[0] % figure->animations[currentAnimation].animAnz;
-            break;
-        case 110:
-            frame = t_frameValues[1] % figure->animations[currentAnimation].animAnz;
-            break;
-        case 130:
-            frame = t_frameValues[2] % figure->animations[currentAnimation].animAnz;
-            break;
-        case 135:
-            frame = t_frameValues[3] % figure->animations[currentAnimation].animAnz;
-            break;
-        case 195:
-            frame = t_frameValues[4] % figure->animations[currentAnimation].animAnz;
-            break;
-        case 300:
-            frame = t_frameValues[5] % figure->animations[currentAnimation].animAnz;
-            break;
-        case 500:
-            frame = t_frameValues[6] % figure->animations[currentAnimation].animAnz;
-            break;
-        case 750:
-            frame = t_frameValues[7] % figure->animations[currentAnimation].animAnz;
-            break;
-        case 1000:
-            frame = t_frameValues[8] % figure->animations[currentAnimation].animAnz;
-            break;
-        default:
-            frame = 0;
-    }
-}
-
 void mdcii::world::tile::to_json(nlohmann::json& t_json, const world::tile::FigureTile& t_tile)
 {
     if (t_tile.HasFigure())
@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <type_traits>
 #include "Tile.h"
 #include "vendor/nlohmann/json.hpp"
 
@@ -51,15 +52,6 @@ namespace mdcii::world::tile
      */
     struct FigureTile : public Tile
     {
-        //-------------------------------------------------
-        // Constants
-        //-------------------------------------------------
-
-        /**
-         * @brief The number of possible animation times.
-         */
-        static constexpr auto NR_OF_ANIM_TIMES{ 9 };
-
         //-------------------------------------------------
         // Member
         //-------------------------------------------------
@@ -112,18 +104,7 @@ namespace mdcii::world::tile
         [[nodiscard]] bool HasFigure(resource::FigureId t_figureId) const;
 
         //-------------------------------------------------
-        // Logic
-        //-------------------------------------------------
-
-        /**
-         * @brief Set the current animation frame.
-         *
-         * @param t_frameValues The current frame values for all animation times.
-         */
-        void UpdateFrame(const std::array<int, NR_OF_ANIM_TIMES>& t_frameValues);
-
-        //-------------------------------------------------
-        // Override
+        // Render
         //-------------------------------------------------
 
         /**
@@ -131,14 +112,11 @@ namespace mdcii::world::tile
          *
          * @return True if there is no figure; otherwise false.
          */
-        [[nodiscard]] bool IsNotRenderable() const override { return !HasFigure(); }
-
-        /**
-         * @brief Calculates all gfx values to be stored in `gfxs`.
-         */
-        void CalculateGfxValues() override {}
+        [[nodiscard]] bool IsNotRenderable() const { return !HasFigure(); }
     };
 
+    static_assert(std::is_trivially_copyable_v<FigureTile>);
+
     //-------------------------------------------------
     // Serializing TerrainTile into Json
     //-------------------------------------------------
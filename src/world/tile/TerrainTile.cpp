@@ -18,6 +18,7 @@
 
 #include "TerrainTile.h"
 #include "world/layer/Layer.h"
+#include "resource/GfxTable.h"
 
 //-------------------------------------------------
 // Ctors. / Dtor.
@@ -36,7 +37,7 @@ mdcii::world::tile::TerrainTile::TerrainTile(
     , x{ t_x }
     , y{ t_y }
 {
-    CalculateGfxs();
+    CalculateGfxValues();
 }
 
 mdcii::world::tile::TerrainTile::TerrainTile(
@@ -53,7 +54,7 @@ mdcii::world::tile::TerrainTile::TerrainTile(
     , x{ t_x }
     , y{ t_y }
 {
-    CalculateGfxs();
+    CalculateGfxValues();
 }
 
 //-------------------------------------------------
@@ -65,34 +66,15 @@ bool mdcii::world::tile::TerrainTile::HasBuildingAboveWaterAndCoast() const
     return building != nullptr && building->posoffs > 0;
 }
 
+bool mdcii::world::tile::TerrainTile::IsAnimated() const
+{
+    return building != nullptr && building->animAnz > 1;
+}
+
 //-------------------------------------------------
 // Logic
 //-------------------------------------------------
 
-void mdcii::world::tile::TerrainTile::UpdateFrame(const std::array<int, NR_OF_ANIM_TIMES>& t_frameValues)
-{
-    switch (building->animTime)
-    {
-        case 90:
-            frame = t_frameValues[0] % building->animAnz;
-            break;
-        case 130:
-            frame = t_frameValues[1] % building->animAnz;
-            break;
-        case 150:
-            frame = t_frameValues[2] % building->animAnz;
-            break;
-        case 180:
-            frame = t_frameValues[3] % building->animAnz;
-            break;
-        case 220:
-            frame = t_frameValues[4] % building->animAnz;
-            break;
-        default:
-            frame = 0;
-    }
-}
-
 void mdcii::world::tile::TerrainTile::RenderImGui(const void* t_layer) const
 {
     // this
@@ -109,40 +91,42 @@ void mdcii::world::tile::TerrainTile::RenderImGui(const void* t_layer) const
     ImGui::Separator();
     ImGui::PopStyleColor();
 
-    if (n >= 0 && terrainLayer->sortedTiles.at(magic_enum::enum_integer(terrainLayer->world->camera->rotation)).at(n).type == TileType::TRAFFIC)
+    const auto trafficNeighbors{ terrainLayer->GetTrafficNeighborFlag(posX, posY) };
+
+    if ((trafficNeighbors & NORTH) != 0)
     {
         ImGui::PushStyleColor(ImGuiCol_Text, IM_COL32(0, 255, 0, 255));
         ImGui::Text("North Traffic Tile");
         ImGui::PopStyleColor();
 
-        RenderImGuiTileInfo(terrainLayer->sortedTiles.at(magic_enum::enum_integer(terrainLayer->world->camera->rotation)).at(n));
+        RenderImGuiTileInfo(terrainLayer->tiles.at(n));
     }
 
-    if (s >= 0 && terrainLayer->sortedTiles.at(magic_enum::enum_integer(terrainLayer->world->camera->rotation)).at(s).type == TileType::TRAFFIC)
+    if ((trafficNeighbors & SOUTH) != 0)
     {
         ImGui::PushStyleColor(ImGuiCol_Text, IM_COL32(0, 255, 0, 255));
         ImGui::Text("South Traffic Tile");
         ImGui::PopStyleColor();
 
-        RenderImGuiTileInfo(terrainLayer->sortedTiles.at(magic_enum::enum_integer(terrainLayer->world->camera->rotation)).at(s));
+        RenderImGuiTileInfo(terrainLayer->tiles.at(s));
     }
 
-    if (e >= 0 && terrainLayer->sortedTiles.at(magic_enum::enum_integer(terrainLayer->world->camera->rotation)).at(e).type == TileType::TRAFFIC)
+    if ((trafficNeighbors & EAST) != 0)
     {
         ImGui::PushStyleColor(ImGuiCol_Text, IM_COL32(0, 255, 0, 255));
         ImGui::Text("East Traffic Tile");
         ImGui::PopStyleColor();
 
-        RenderImGuiTileInfo(terrainLayer->sortedTiles.at(magic_enum::enum_integer(terrainLayer->world->camera->rotation)).at(e));
+        RenderImGuiTileInfo(terrainLayer->tiles.at(e));
     }
 
-    if (w >= 0 && terrainLayer->sortedTiles.at(magic_enum::enum_integer(terrainLayer->world->camera->rotation)).at(w).type == TileType::TRAFFIC)
+    if ((trafficNeighbors & WEST) != 0)
     {
         ImGui::PushStyleColor(ImGuiCol_Text, IM_COL32(0, 255, 0, 255));
         ImGui::Text("West Traffic Tile");
         ImGui::PopStyleColor();
 
-        RenderImGuiTileInfo(terrainLayer->sortedTiles.at(magic_enum::enum_integer(terrainLayer->world->camera->rotation)).at(w));
+        RenderImGuiTileInfo(terrainLayer->tiles.at(w));
     }
 }
 
@@ -166,46 +150,6 @@ void mdcii::world::tile::TerrainTile::RenderImGuiTileInfo(const TerrainTile& t_t
 // Gfx
 //-------------------------------------------------
 
-void mdcii::world::tile::TerrainTile::AdjustGfxForBigBuildings(int& t_gfx) const
-{
-    MDCII_ASSERT(HasBuilding(), "[TerrainTile::AdjustGfxForBigBuildings()] Null pointer.")
-
-    // default: orientation 0
-    auto rp{ olc::vi2d(x, y) };
-
-    using enum Rotation;
-
-    if (rotation == magic_enum::enum_integer(DEG270))
-    {
-        rp = rotate_position(
-            x, y,
-            building->size.w, building->size.h,
-            DEG90
-        );
-    }
-
-    if (rotation == magic_enum::enum_integer(DEG180))
-    {
-        rp = rotate_position(
-            x, y,
-            building->size.w, building->size.h,
-            DEG180
-        );
-    }
-
-    if (rotation == magic_enum::enum_integer(DEG90))
-    {
-        rp = rotate_position(
-            x, y,
-            building->size.w, building->size.h,
-            DEG270
-        );
-    }
-
-    const auto offset{ rp.y * building->size.w + rp.x };
-    t_gfx += offset;
-}
-
 bool mdcii::world::tile::TerrainTile::DetermineTrafficGfx(const uint8_t t_neighborFlag)
 {
     MDCII_ASSERT(HasBuilding(), "[TerrainTile::DetermineTrafficGfx()] Null pointer.")
@@ -248,47 +192,19 @@ bool mdcii::world::tile::TerrainTile::DetermineTrafficGfx(const uint8_t t_neighb
         default: roadGfx = ROAD_WE;
     }
 
-    auto newGfxInt{ magic_enum::enum_integer(roadGfx) };
-
-    if (building->id == resource::DIRT_ROAD_ID)
-    {
-        newGfxInt += 20;
-    }
-
-    MDCII_ASSERT(!gfxs.empty(), "[TerrainTile::DetermineTrafficGfx()] Invalid gfx values.")
+    MDCII_ASSERT(gfxIndex >= 0, "[TerrainTile::DetermineTrafficGfx()] Invalid gfx values.")
 
-    const auto oldGfx{ gfxs[0] };
-    gfxs[0] = newGfxInt;
+    const auto oldGfxIndex{ gfxIndex };
+    gfxIndex = resource::GfxTable::GetRoadIndex(building, roadGfx);
 
-    return oldGfx != newGfxInt;
+    return oldGfxIndex != gfxIndex;
 }
 
-//-------------------------------------------------
-// Override
-//-------------------------------------------------
-
 void mdcii::world::tile::TerrainTile::CalculateGfxValues()
 {
     MDCII_ASSERT(HasBuilding(), "[TerrainTile::CalculateGfxValues()] Null pointer.")
-    MDCII_ASSERT(gfxs.empty(), "[TerrainTile::CalculateGfxValues()] Invalid gfx values.")
 
-    const auto gfx0{ building->gfx };
-
-    gfxs.push_back(gfx0);
-    if (building->IsRotatable())
-    {
-        gfxs.push_back(gfx0 + (1 * building->rotate));
-        gfxs.push_back(gfx0 + (2 * building->rotate));
-        gfxs.push_back(gfx0 + (3 * building->rotate));
-    }
-
-    if (building->IsBig())
-    {
-        for (auto& gfx : gfxs)
-        {
-            AdjustGfxForBigBuildings(gfx);
-        }
-    }
+    gfxIndex = resource::GfxTable::GetIndex(building, x, y, rotation);
 }
 
 //-------------------------------------------------
@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <type_traits>
 #include "Tile.h"
 #include "vendor/nlohmann/json.hpp"
 
@@ -46,15 +47,6 @@ namespace mdcii::world::tile
      */
     struct TerrainTile : public Tile
     {
-        //-------------------------------------------------
-        // Constants
-        //-------------------------------------------------
-
-        /**
-         * @brief The number of possible animation times.
-         */
-        static constexpr auto NR_OF_ANIM_TIMES{ 5 };
-
         //-------------------------------------------------
         // Member
         //-------------------------------------------------
@@ -87,6 +79,11 @@ namespace mdcii::world::tile
          */
         int y{ 0 };
 
+        /**
+         * @brief The index of the gfx values in the GfxTable.
+         */
+        int32_t gfxIndex{ -1 };
+
         //-------------------------------------------------
         // Ctors. / Dtor.
         //-------------------------------------------------
@@ -136,16 +133,16 @@ namespace mdcii::world::tile
          */
         [[nodiscard]] bool HasBuildingAboveWaterAndCoast() const;
 
-        //-------------------------------------------------
-        // Logic
-        //-------------------------------------------------
-
         /**
-         * @brief Set the current animation frame.
+         * @brief Checks whether the frame of the tile changes over time.
          *
-         * @param t_frameValues The current frame values for all animation times.
+         * @return True if a Building object is present and has more than one animation frame.
          */
-        void UpdateFrame(const std::array<int, NR_OF_ANIM_TIMES>& t_frameValues);
+        [[nodiscard]] bool IsAnimated() const;
+
+        //-------------------------------------------------
+        // Logic
+        //-------------------------------------------------
 
         /**
          * @brief Renders some information about this tile and its neighbors using ImGui.
@@ -166,16 +163,9 @@ namespace mdcii::world::tile
         //-------------------------------------------------
 
         /**
-         * @brief Calculates all gfx values to be stored in `gfxs`.
-         */
-        void CalculateGfxs() { CalculateGfxValues(); }
-
-        /**
-         * @brief Adjusts gfx values for large buildings.
-         *
-         * @param t_gfx The gfx of the terrain tile.
+         * @brief Sets `gfxIndex` to the entry of this part of the building.
          */
-        void AdjustGfxForBigBuildings(int& t_gfx) const;
+        void CalculateGfxValues();
 
         /**
          * @brief Determines the correct gfx for this tile depending on the neighbors.
@@ -187,7 +177,7 @@ namespace mdcii::world::tile
         bool DetermineTrafficGfx(uint8_t t_neighborFlag);
 
         //-------------------------------------------------
-        // Override
+        // Render
         //-------------------------------------------------
 
         /**
@@ -195,14 +185,11 @@ namespace mdcii::world::tile
          *
          * @return True if there is no building; otherwise false.
          */
-        [[nodiscard]] bool IsNotRenderable() const override { return !HasBuilding(); }
-
-        /**
-         * @brief Calculates all gfx values to be stored in `gfxs`.
-         */
-        void CalculateGfxValues() override;
+        [[nodiscard]] bool IsNotRenderable() const { return !HasBuilding(); }
     };
 
+    static_assert(std::is_trivially_copyable_v<TerrainTile>);
+
     //-------------------------------------------------
     // Serializing TerrainTile into Json
     //-------------------------------------------------
@@ -18,17 +18,8 @@
 
 #pragma once
 
-#include <vector>
 #include <cstdint>
 
-namespace mdcii::world
-{
-    /**
-     * @brief Forward declaration enum class Rotation.
-     */
-    enum class Rotation;
-}
-
 namespace mdcii::world::tile
 {
     //-------------------------------------------------
@@ -38,7 +29,8 @@ namespace mdcii::world::tile
     /**
      * @brief Represents a Tile.
      *
-     * The base class of all Tile objects.
+     * The base class of all Tile objects. Tiles are trivially copyable and
+     * store all values inline, so that the tiles of a layer are packed in memory.
      */
     struct Tile
     {
@@ -49,7 +41,7 @@ namespace mdcii::world::tile
         /**
          * @brief The type of the tile.
          */
-        enum class TileType
+        enum class TileType : uint8_t
         {
             NONE,
             RESIDENTIAL,
@@ -72,14 +64,6 @@ namespace mdcii::world::tile
         // Member
         //-------------------------------------------------
 
-        /**
-         * @brief The rotation  of the tile.
-         *
-         * There are rotations for the terrain (islands, deep water): [DEG0, DEG90, DEG180, DEG270].
-         * Figures use additional rotations.
-         */
-        int rotation{ 0 };
-
         /**
          * @brief Represents the x position for the first rotation (e.g. DEG0) of a tile relative to its parent island.
          *
@@ -97,32 +81,22 @@ namespace mdcii::world::tile
         int posY{ -1 };
 
         /**
-         * @brief The gfx for each tile rotation.
+         * @brief The rotation  of the tile.
          *
-         * In some cases the same gfx is used for all rotations.
          * There are rotations for the terrain (islands, deep water): [DEG0, DEG90, DEG180, DEG270].
-         * Figures may use additional rotations.
-         */
-        std::vector<int> gfxs{};
-
-        /**
-         * @brief The render index for each rotation.
-         *
-         * The tiles with their gfx are always rendered from top right to bottom left.
-         * This index is responsible for sorting the tile in each rotation.
-         * The values are calculated using the GetRenderIndex() method.
+         * Figures use additional rotations.
          */
-        std::vector<int> renderIndices{};
+        uint8_t rotation{ 0 };
 
         /**
          * @brief Used to get the current gfx for animation.
          */
-        int frame{ 0 };
+        uint8_t frame{ 0 };
 
         /**
          * @brief Can be used e.g. as a flag to highlight the tile.
          */
-        int tintFlag{ -1 };
+        int8_t tintFlag{ -1 };
 
         /**
          * @brief The type of the Tile.
@@ -164,51 +138,5 @@ namespace mdcii::world::tile
          * @param t_tileType The tile type.
          */
         Tile(int t_rotation, int t_posX, int t_posY, TileType t_tileType = TileType::NONE);
-
-        virtual ~Tile() noexcept = default;
-
-        //-------------------------------------------------
-        // Override
-        //-------------------------------------------------
-
-        /**
-         * @brief Returns whether a tile is not renderable.
-         *
-         * @return True or false.
-         */
-        [[nodiscard]] virtual bool IsNotRenderable() const = 0;
-
-        /**
-         * @brief Calculates all gfx values to be stored in `gfxs`.
-         */
-        virtual void CalculateGfxValues() = 0;
-
-        //-------------------------------------------------
-        // Render index
-        //-------------------------------------------------
-
-        /**
-         * @brief 2D/1D - mapping of a position.
-         *
-         * The method determines a value for a specific position and rotation, which is used
-         * to sort the tile for rendering. The value can also be negative.
-         *
-         * @param t_x The 2D x position.
-         * @param t_y The 2D y position.
-         * @param t_width The width of the 2D array.
-         * @param t_height The height of the 2D array.
-         * @param t_rotation The given position is previously rotated by the specified rotation.
-         *
-         * @return The 1D index.
-         */
-        [[nodiscard]] static int GetRenderIndex(int t_x, int t_y, int t_width, int t_height, Rotation t_rotation);
-
-        /**
-         * @brief Calculates the render sort positions for all rotations.
-         *
-         * @param t_width The width of the 2D array.
-         * @param t_height The height of the 2D array.
-         */
-        void CalcRenderPositions(int t_width, int t_height);
     };
 }